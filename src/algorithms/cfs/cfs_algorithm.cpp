@@ -0,0 +1,77 @@
+#include "algorithms/cfs/cfs_algorithm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+/*
+    The Completely Fair Scheduler (CFS) scheduling algorithm -- runs the ready thread with the least weighted CPU time
+    for its share of a target latency.
+*/
+
+CFSScheduler::CFSScheduler(const ThreadTable& threads, int64_t target_latency, int64_t min_granularity)
+	: threads(threads), target_latency(target_latency), min_granularity(min_granularity) {
+	if (target_latency <= 0 || min_granularity <= 0) {
+		throw std::invalid_argument("CFS must have a positive target latency and minimum granularity");
+	}
+}
+
+SchedulingDecision CFSScheduler::get_next_thread() {
+	size_t rq_size = size();
+	SchedulingDecision sd;
+	if (rq_size > 0) {
+		auto leftmost = ready_tree.begin();
+		ThreadHandle next_thr = leftmost->thread;
+		min_vruntime = std::max(min_vruntime, leftmost->vruntime);
+
+		// The thread's share of the latency, among the runnable threads including itself.
+		int64_t weight = weight_of(next_thr);
+		int64_t slice = std::max(min_granularity, target_latency * weight / ready_weight);
+		ready_weight -= weight;
+		ready_tree.erase(leftmost);
+
+		sd.thread = next_thr;
+		sd.reason = RUN_LEAST_VRUNTIME;
+		sd.ready_count = (uint32_t)rq_size;
+		sd.time_slice = slice;
+	} else {
+		sd.thread = NO_THREAD;
+		sd.reason = READY_QUEUE_EMPTY;
+	}
+	return sd;
+}
+
+void CFSScheduler::add_to_ready_queue(ThreadHandle thread) {
+	int64_t weight = weight_of(thread);
+	if (thread >= vruntime.size()) {
+		vruntime.resize((size_t)thread + 1, 0);
+		accounted_service.resize((size_t)thread + 1, 0);
+	}
+
+	// Charge the CPU time the thread has had since it was last ready, scaled by its weight.
+	int64_t ran = threads.service_time[thread] - accounted_service[thread];
+	accounted_service[thread] = threads.service_time[thread];
+	vruntime[thread] += ran * NICE_0_WEIGHT * VRUNTIME_SCALE / weight;
+
+	// A thread that was not ready (new, or back from I/O) does not get credit for that time.
+	if (threads.previous_state[thread] != ThreadState::RUNNING) {
+		vruntime[thread] = std::max(vruntime[thread], min_vruntime);
+	}
+
+	ready_tree.insert({ vruntime[thread], added++, thread });
+	ready_weight += weight;
+}
+
+size_t CFSScheduler::size() const {
+	return ready_tree.size();
+}
+
+int64_t CFSScheduler::vruntime_of(ThreadHandle thread) const {
+	return (thread < vruntime.size()) ? vruntime[thread] : 0;
+}
+
+int64_t CFSScheduler::weight_of(ThreadHandle thread) const {
+	ProcessPriority priority = threads.priority[thread];
+	assert(priority <= BATCH);
+	return PRIORITY_WEIGHTS[priority];
+}
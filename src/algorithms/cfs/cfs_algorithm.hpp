@@ -0,0 +1,138 @@
+#ifndef CFS_ALGORITHM_HPP
+#define CFS_ALGORITHM_HPP
+
+#include <cstdint>
+#include <set>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    CFSScheduler:
+        A representation of the Completely Fair Scheduler of Linux. Each thread has a virtual
+        runtime: the time it has spent on the CPU, scaled down by the weight of its process's
+        priority. The ready thread with the least virtual runtime runs next, so over time each
+        thread gets CPU time in proportion to its weight.
+
+        The thread runs for its share of the target latency, i.e. the latency times its weight
+        over the weight of all runnable threads (latency / n if they all have the same weight),
+        but for at least the minimum granularity, and is then preempted.
+
+        A new thread starts at the least virtual runtime of the ready threads so far, and a thread
+        back from I/O is moved up to it, so that neither can make up for time it was not ready.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        The ready threads are kept in a red-black tree (std::set) ordered by virtual runtime,
+        whose leftmost node is cached, so the next thread is found in O(1) and adding one is
+        O(log n) in the number of ready threads.
+*/
+
+class CFSScheduler : public Scheduler {
+public:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	/*
+		NICE_0_WEIGHT:
+			The weight of a NORMAL thread. Virtual runtime passes at the speed of real time
+			for it, faster for lighter threads and slower for heavier ones.
+	*/
+	static constexpr int64_t NICE_0_WEIGHT = 1024;
+
+	/*
+		PRIORITY_WEIGHTS:
+			The weight of each ProcessPriority. These are the Linux weights of nice -10, -5, 0
+			and 5, so each priority gets about three times the CPU time of the one below it.
+	*/
+	static constexpr int64_t PRIORITY_WEIGHTS[4] = { 9548, 3121, 1024, 335 };
+	static_assert(BATCH + 1 == sizeof(PRIORITY_WEIGHTS) / sizeof(PRIORITY_WEIGHTS[0]),
+		"PRIORITY_WEIGHTS needs a weight for every ProcessPriority");
+
+	/*
+		VRUNTIME_SCALE:
+			Virtual runtimes are kept in units of 1/VRUNTIME_SCALE ticks, so that a heavy
+			thread's short runs still move it along.
+	*/
+	static constexpr int64_t VRUNTIME_SCALE = 1024;
+
+	/*
+		ReadyThread:
+			A thread in the ready tree, with its virtual runtime and its place in the order
+			threads became ready, which breaks ties.
+	*/
+	struct ReadyThread {
+		int64_t vruntime;
+		uint64_t order;
+		ThreadHandle thread;
+
+		bool operator<(const ReadyThread& other) const {
+			if (vruntime != other.vruntime) {
+				return vruntime < other.vruntime;
+			}
+			return order < other.order;
+		}
+	};
+
+	std::set<ReadyThread> ready_tree;
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/*
+		CFSScheduler(threads, target_latency, min_granularity):
+			The scheduler looks up each thread's priority and CPU time in 'threads', which
+			must outlive it. Both durations must be positive.
+	*/
+	CFSScheduler(const ThreadTable& threads, int64_t target_latency = 24, int64_t min_granularity = 3);
+
+	SchedulingDecision get_next_thread();
+
+	void add_to_ready_queue(ThreadHandle thread);
+
+	size_t size() const;
+
+	/*
+		vruntime_of(thread):
+			Returns the thread's virtual runtime, in units of 1/VRUNTIME_SCALE ticks.
+	*/
+	int64_t vruntime_of(ThreadHandle thread) const;
+
+private:
+	const ThreadTable& threads;
+	int64_t target_latency;
+	int64_t min_granularity;
+
+	/*
+		The least virtual runtime of a ready thread so far. It never goes backwards.
+	*/
+	int64_t min_vruntime = 0;
+
+	/*
+		The total weight of the ready threads.
+	*/
+	int64_t ready_weight = 0;
+
+	/*
+		How many threads have been added so far, to number the next one.
+	*/
+	uint64_t added = 0;
+
+	/*
+		Per thread, indexed by handle: its virtual runtime, and its service time when that
+		was last brought up to date.
+	*/
+	std::vector<int64_t> vruntime;
+	std::vector<int64_t> accounted_service;
+
+	/*
+		weight_of(thread):
+			Returns the weight of the thread's priority. The readers only accept the four
+			process types, so anything else is a bug.
+	*/
+	int64_t weight_of(ThreadHandle thread) const;
+};
+
+#endif
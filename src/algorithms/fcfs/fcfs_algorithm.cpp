@@ -1,7 +1,6 @@
 #include "algorithms/fcfs/fcfs_algorithm.hpp"
 
 #include <cassert>
-#include <sstream>
 #include <string>
 #include <stdexcept>
 
@@ -12,32 +11,29 @@
     Here is where you should define the logic for the FCFS algorithm.
 */
 
-FCFSScheduler::FCFSScheduler(int slice) {
+FCFSScheduler::FCFSScheduler(int64_t slice) {
 	if (slice != -1) {
 		throw("FCFS must have a timeslice of -1");
 	}
 }
 
-std::shared_ptr<SchedulingDecision> FCFSScheduler::get_next_thread() {
+SchedulingDecision FCFSScheduler::get_next_thread() {
 	size_t rq_size = size();
-	std::shared_ptr<SchedulingDecision> sd = std::make_shared<SchedulingDecision>();
+	SchedulingDecision sd;
 	if (rq_size > 0) {
-		std::shared_ptr<Thread> next_thr = ready_queue.front();
+		ThreadHandle next_thr = ready_queue.front();
 		ready_queue.pop();
-		sd->thread = next_thr;
-		std::ostringstream oss;
-		oss << "Selected from " << rq_size << " threads. Will run to completion of burst.";
-		sd->explanation = oss.str();
+		sd.thread = next_thr;
+		sd.reason = RUN_TO_COMPLETION;
+		sd.ready_count = (uint32_t)rq_size;
 	} else {
-		sd->thread = nullptr;
-		std::ostringstream oss;
-		oss << "No threads left in ready queue to execute.";
-		sd->explanation = oss.str();
+		sd.thread = NO_THREAD;
+		sd.reason = READY_QUEUE_EMPTY;
 	}
 	return sd;
 }
 
-void FCFSScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+void FCFSScheduler::add_to_ready_queue(ThreadHandle thread) {
 	ready_queue.push(thread);
 }
 
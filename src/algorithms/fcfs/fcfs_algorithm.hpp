@@ -23,18 +23,18 @@ public:
 	//==================================================
 
 	// Add any member variables you may need.
-	std::queue<std::shared_ptr<Thread>> ready_queue;
+	std::queue<ThreadHandle> ready_queue;
 
 
 	//==================================================
 	//  Member functions
 	//==================================================
 
-	FCFSScheduler(int slice = -1);
+	FCFSScheduler(int64_t slice = -1);
 
-	std::shared_ptr<SchedulingDecision> get_next_thread();
+	SchedulingDecision get_next_thread();
 
-	void add_to_ready_queue(std::shared_ptr<Thread> thread);
+	void add_to_ready_queue(ThreadHandle thread);
 
 	size_t size() const;
 
@@ -0,0 +1,123 @@
+#include "algorithms/mlfq/mlfq_algorithm.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+/*
+    The multilevel feedback queue (MLFQ) scheduling algorithm -- runs threads from the highest non-empty level for that
+    level's time slice, moving them down when they use it up and up when they come back from I/O.
+*/
+
+MLFQScheduler::MLFQScheduler(const ThreadTable& threads, int level_count, int64_t slice, int64_t boost_interval)
+	: threads(threads), boost_interval(boost_interval) {
+	if (level_count < 1 || level_count > MAX_LEVELS) {
+		throw std::invalid_argument("MLFQ must have between 1 and 32 levels");
+	}
+	if (slice <= 0) {
+		throw std::invalid_argument("MLFQ must have a positive time slice");
+	}
+	levels.resize(level_count);
+	for (Level& l : levels) {
+		l.time_slice = slice;
+		slice = (slice > std::numeric_limits<int64_t>::max() / 2) ? slice : slice * 2;
+	}
+}
+
+SchedulingDecision MLFQScheduler::get_next_thread() {
+	size_t rq_size = size();
+	SchedulingDecision sd;
+	if (rq_size > 0) {
+		// Level 0 is the top, so the lowest set bit is the highest level with a ready thread.
+		int l = __builtin_ctz(ready_mask);
+		Level& from = levels[l];
+		ThreadHandle next_thr = from.head;
+		from.head = next_ready[next_thr];
+		if (from.head == NO_THREAD) {
+			from.tail = NO_THREAD;
+			ready_mask &= ~(1u << l);
+		}
+		ready_count--;
+		sd.thread = next_thr;
+		sd.reason = RUN_FOR_LEVEL_SLICE;
+		sd.ready_count = (uint32_t)rq_size;
+		sd.time_slice = from.time_slice;
+	} else {
+		sd.thread = NO_THREAD;
+		sd.reason = READY_QUEUE_EMPTY;
+	}
+	return sd;
+}
+
+void MLFQScheduler::add_to_ready_queue(ThreadHandle thread) {
+	if (thread >= level.size()) {
+		level.resize((size_t)thread + 1, 0);
+		level_boost.resize((size_t)thread + 1, 0);
+		next_ready.resize((size_t)thread + 1, NO_THREAD);
+	}
+
+	// The thread was just made READY, so its previous state says why it is back.
+	int l = level_of(thread);
+	switch (threads.previous_state[thread]) {
+	case ThreadState::RUNNING:
+		// Preempted at the end of its slice.
+		l = std::min(l + 1, (int)levels.size() - 1);
+		break;
+	case ThreadState::BLOCKED:
+		// Back from I/O.
+		l = std::max(l - 1, 0);
+		break;
+	default:
+		l = 0;
+		break;
+	}
+	level[thread] = (uint8_t)l;
+	level_boost[thread] = boost;
+
+	Level& to = levels[l];
+	next_ready[thread] = NO_THREAD;
+	if (to.tail == NO_THREAD) {
+		to.head = thread;
+		ready_mask |= 1u << l;
+	} else {
+		next_ready[to.tail] = thread;
+	}
+	to.tail = thread;
+	ready_count++;
+}
+
+void MLFQScheduler::advance_time(int64_t time) {
+	if (boost_interval <= 0 || time / boost_interval == boost) {
+		return;
+	}
+	// However many intervals have passed, one boost leaves every thread at the top.
+	boost = time / boost_interval;
+	Level& top = levels[0];
+	for (size_t l = 1; l < levels.size(); ++l) {
+		Level& from = levels[l];
+		if (from.head == NO_THREAD) {
+			continue;
+		}
+		if (top.tail == NO_THREAD) {
+			top.head = from.head;
+		} else {
+			next_ready[top.tail] = from.head;
+		}
+		top.tail = from.tail;
+		from.head = from.tail = NO_THREAD;
+	}
+	if (ready_mask != 0) {
+		ready_mask = 1;
+	}
+}
+
+int MLFQScheduler::level_of(ThreadHandle thread) const {
+	if (thread >= level.size() || level_boost[thread] != boost) {
+		return 0;
+	}
+	return level[thread];
+}
+
+size_t MLFQScheduler::size() const {
+	return ready_count;
+}
@@ -0,0 +1,105 @@
+#ifndef MLFQ_ALGORITHM_HPP
+#define MLFQ_ALGORITHM_HPP
+
+#include <cstdint>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    MLFQScheduler:
+        A representation of a multilevel feedback queue scheduling algorithm. Threads start
+        in the top level, and the ready thread in the highest non-empty level runs next, for
+        at most that level's time slice. The slice doubles from one level to the next.
+
+        A thread that uses up its slice is preempted and moves down a level, and a thread
+        that comes back from I/O moves up a level, so threads that do little at a time stay
+        on top. Every boost interval, all threads go back to the top level, so that the ones
+        at the bottom do not starve.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        Each level is a FIFO linked through the thread handles, and a bit mask records the
+        levels that are not empty, so adding a thread and picking the next one take constant
+        time. A boost splices the lower FIFOs onto the top one in level order, and the level
+        of every other thread is reset lazily: it is only valid for the boost in which it was
+        set. So a boost costs one step per level, however many threads there are.
+*/
+
+class MLFQScheduler : public Scheduler {
+public:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	/*
+		MAX_LEVELS:
+			The most levels a scheduler can have, one per bit of the level mask.
+	*/
+	static constexpr int MAX_LEVELS = 32;
+
+	/*
+		Level:
+			One level's FIFO, as the first and last thread in it. Each thread links to the
+			one after it through next_ready.
+	*/
+	struct Level {
+		ThreadHandle head = NO_THREAD;
+		ThreadHandle tail = NO_THREAD;
+		int64_t time_slice = 0;
+	};
+
+	std::vector<Level> levels;
+
+	/*
+		ready_mask:
+			Bit l is set if level l is not empty.
+	*/
+	uint32_t ready_mask = 0;
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/*
+		MLFQScheduler(threads, level_count, slice, boost_interval):
+			The scheduler looks up how each thread became ready in 'threads', which must
+			outlive it. The top level's time slice is 'slice', and each level below has
+			twice the slice of the one above it. A boost_interval of -1 disables the boost.
+	*/
+	MLFQScheduler(const ThreadTable& threads, int level_count = 3, int64_t slice = 3, int64_t boost_interval = 100);
+
+	SchedulingDecision get_next_thread();
+
+	void add_to_ready_queue(ThreadHandle thread);
+
+	void advance_time(int64_t time);
+
+	size_t size() const;
+
+	/*
+		level_of(thread):
+			Returns the level the thread is in, or will be in when it is next added.
+	*/
+	int level_of(ThreadHandle thread) const;
+
+private:
+	const ThreadTable& threads;
+	int64_t boost_interval;
+	size_t ready_count = 0;
+
+	/*
+		The number of boosts so far. A thread's level only holds for the boost it was set in.
+	*/
+	int64_t boost = 0;
+
+	/*
+		Per thread, indexed by handle: its level, the boost in which that was set, and the
+		thread after it in its level's FIFO.
+	*/
+	std::vector<uint8_t> level;
+	std::vector<int64_t> level_boost;
+	std::vector<ThreadHandle> next_ready;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "algorithms/priority/priority_algorithm.hpp"
+
+#include <cassert>
+
+/*
+    The priority scheduling algorithm -- runs the ready thread of the highest priority process, first-come,
+    first-served within a priority.
+*/
+
+PriorityScheduler::PriorityScheduler(const ThreadTable& threads, bool preemptive, int64_t slice)
+	: threads(threads), preemptive(preemptive) {
+	if (slice != -1) {
+		throw("PRIORITY must have a timeslice of -1");
+	}
+}
+
+SchedulingDecision PriorityScheduler::get_next_thread() {
+	size_t rq_size = size();
+	SchedulingDecision sd;
+	if (rq_size > 0) {
+		// SYSTEM is bit 0, so the lowest set bit is the highest priority with a ready thread.
+		int priority = __builtin_ctz(ready_mask);
+		std::queue<ThreadHandle>& queue = ready_queues[priority];
+		ThreadHandle next_thr = queue.front();
+		queue.pop();
+		if (queue.empty()) {
+			ready_mask &= ~(1u << priority);
+		}
+		ready_count--;
+		sd.thread = next_thr;
+		sd.reason = RUN_HIGHEST_PRIORITY;
+		sd.ready_count = (uint32_t)rq_size;
+	} else {
+		sd.thread = NO_THREAD;
+		sd.reason = READY_QUEUE_EMPTY;
+	}
+	return sd;
+}
+
+void PriorityScheduler::add_to_ready_queue(ThreadHandle thread) {
+	// The readers only accept the four process types, so anything else is a bug.
+	int priority = threads.priority[thread];
+	assert(priority <= BATCH);
+	ready_queues[priority].push(thread);
+	ready_mask |= 1u << priority;
+	ready_count++;
+}
+
+bool PriorityScheduler::should_preempt(ThreadHandle running, int64_t /*running_left*/, ThreadHandle ready) {
+	return preemptive && threads.priority[ready] < threads.priority[running];
+}
+
+size_t PriorityScheduler::size() const {
+	return ready_count;
+}
@@ -0,0 +1,70 @@
+#ifndef PRIORITY_ALGORITHM_HPP
+#define PRIORITY_ALGORITHM_HPP
+
+#include <cstdint>
+#include <queue>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    PriorityScheduler:
+        A representation of a priority scheduling algorithm. The ready thread whose process
+        has the highest priority (SYSTEM, then INTERACTIVE, NORMAL and BATCH) runs next, to
+        the completion of its burst. Threads of the same priority run first-come, first-served.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        There is one FIFO per priority, and a bit mask of the ones that are not empty, so
+        adding a thread and picking the next one take constant time however many threads
+        are ready: the next thread comes from the FIFO of the lowest set bit.
+
+        If preemptive, a running thread is preempted as soon as a thread of a higher
+        priority becomes ready, and goes back to the end of its FIFO.
+*/
+
+class PriorityScheduler : public Scheduler {
+public:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	/*
+		PRIORITY_COUNT:
+			The number of priorities, one per ProcessPriority.
+	*/
+	static constexpr int PRIORITY_COUNT = 4;
+
+	std::queue<ThreadHandle> ready_queues[PRIORITY_COUNT];
+
+	/*
+		ready_mask:
+			Bit p is set if ready_queues[p] is not empty.
+	*/
+	uint32_t ready_mask = 0;
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/*
+		PriorityScheduler(threads, preemptive, slice):
+			The scheduler looks up each thread's priority in 'threads', which must outlive
+			it. The priorities are not time sliced, so the slice must be -1.
+	*/
+	PriorityScheduler(const ThreadTable& threads, bool preemptive = false, int64_t slice = -1);
+
+	SchedulingDecision get_next_thread();
+
+	void add_to_ready_queue(ThreadHandle thread);
+
+	bool should_preempt(ThreadHandle running, int64_t running_left, ThreadHandle ready);
+
+	size_t size() const;
+
+private:
+	const ThreadTable& threads;
+	bool preemptive;
+	size_t ready_count = 0;
+};
+
+#endif
@@ -2,38 +2,33 @@
 
 #include <cassert>
 #include <stdexcept>
-#include <sstream>
 
 /*
     The round-robin (RR) scheduling algorithm -- utilizes a preemptive queue-based mechanism for slicing and queueing threads.
 */
 
-RRScheduler::RRScheduler(int slice) {    
+RRScheduler::RRScheduler(int64_t slice) {    
     this->time_slice = slice;
 }
 
-std::shared_ptr<SchedulingDecision> RRScheduler::get_next_thread() {
+SchedulingDecision RRScheduler::get_next_thread() {
 	size_t rq_size = size();
-	std::shared_ptr<SchedulingDecision> sd = std::make_shared<SchedulingDecision>();
+	SchedulingDecision sd;
 	if (rq_size > 0) {
-		std::shared_ptr<Thread> next_thr = ready_queue.front();
+		ThreadHandle next_thr = ready_queue.front();
 		ready_queue.pop();
-		sd->thread = next_thr;
-		std::ostringstream oss;
-		oss << "Selected from " << rq_size << " threads. ";
-		oss << "Will run for at most " << this->time_slice << " ticks.";
-		sd->time_slice = this->time_slice;
-		sd->explanation = oss.str();
+		sd.thread = next_thr;
+		sd.reason = RUN_FOR_TIME_SLICE;
+		sd.ready_count = (uint32_t)rq_size;
+		sd.time_slice = this->time_slice;
 	} else {
-		sd->thread = nullptr;
-		std::ostringstream oss;
-		oss << "No threads left in ready queue to execute.";
-		sd->explanation = oss.str();
+		sd.thread = NO_THREAD;
+		sd.reason = READY_QUEUE_EMPTY;
 	}
 	return sd;
 }
 
-void RRScheduler::add_to_ready_queue(std::shared_ptr<Thread> thread) {
+void RRScheduler::add_to_ready_queue(ThreadHandle thread) {
 	ready_queue.push(thread);
 }
 
@@ -2,6 +2,7 @@
 #define RR_ALGORITHM_HPP
 
 #include <memory>
+#include <queue>
 #include <vector>
 #include <utility>
 #include <iterator>
@@ -26,22 +27,22 @@ public:
     //==================================================
 
     // Add any member variables you may need.
-    std::queue<std::shared_ptr<Thread>> ready_queue;
+    std::queue<ThreadHandle> ready_queue;
 
     //==================================================
     //  Member functions
     //==================================================
 
-    RRScheduler(int slice = 3);
+    RRScheduler(int64_t slice = 3);
 
-    std::shared_ptr<SchedulingDecision> get_next_thread();
+    SchedulingDecision get_next_thread();
 
-    void add_to_ready_queue(std::shared_ptr<Thread> thread);
+    void add_to_ready_queue(ThreadHandle thread);
 
     size_t size() const;
 
 private:
-    int time_slice = -1;
+    int64_t time_slice = -1;
 };
 
 #endif
\ No newline at end of file
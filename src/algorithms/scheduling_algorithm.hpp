@@ -1,11 +1,12 @@
 #ifndef SCHEDULING_ALGORITHM_HPP
 #define SCHEDULING_ALGORITHM_HPP
 
+#include <cstdint>
 #include <memory>
 #include "types/enums.hpp"
 #include "types/event/event.hpp"
 #include "types/scheduling_decision/scheduling_decision.hpp"
-#include "types/thread/thread.hpp"
+#include "types/thread_table/thread_table.hpp"
 
 /*
     Scheduler:
@@ -29,7 +30,7 @@ public:
             should not be preempted. If provided a time slice input for a preemptive value, it should be greater
             than zero. The default time slice for all preemptive algorithms should be 3.
     */
-    int time_slice = -1;
+    int64_t time_slice = -1;
 
     //==================================================
     //  Member functions
@@ -39,25 +40,44 @@ public:
         get_next_thread():
             This function tries to get the next thread to run based on the scheduling algorithm.
 
-            It returns a SchedulingDecision object (see the SchedulingDecision class for more info)
+            It returns a SchedulingDecision by value (see the SchedulingDecision class for more info)
             that contains:
-                The next thread, or nullptr if no thread is available.
+                The next thread's handle, or NO_THREAD if no thread is available.
                 The time slice if the algorithm is preemptive.
-                A message explaining the decision.
-                    This might be, for the first come, first served algorithm, something like this:
+                A reason code and the numbers that explain the decision.
+                    For the first come, first served algorithm, this might be RUN_TO_COMPLETION
+                    and the number of ready threads, which SchedulingDecision::explanation() renders as:
                         "Selected from 9 threads. Will run to completion of burst."
                     This message is used when printing the state transitions (see the Logger class).
     */
-    virtual std::shared_ptr<SchedulingDecision> get_next_thread() = 0;
+    virtual SchedulingDecision get_next_thread() = 0;
 
     /*
-        add_to_ready_queue(Thread):
-            Takes in a thread and adds it to the "ready queue" for the scheduling
+        add_to_ready_queue(thread):
+            Takes in a thread's handle and adds it to the "ready queue" for the scheduling
             algorithm. For first come, first served this might be a single queue, but for more complex
             algorithms you may have multiple queues, and there may be more logic involved in determining
             which queue the thread should be placed in.
     */
-    virtual void add_to_ready_queue(std::shared_ptr<Thread> thread) = 0;
+    virtual void add_to_ready_queue(ThreadHandle thread) = 0;
+
+    /*
+        should_preempt(running, running_left, ready):
+            Called when a thread becomes READY while another one is in the middle of a CPU burst.
+            'running' is the thread on the CPU, with running_left of its burst still to go, and 'ready'
+            is the thread that was just added to the ready queue. Returning true preempts the running
+            thread right away: it goes back to the ready queue with the rest of its burst, and the
+            dispatcher is invoked. Non-preemptive algorithms keep the default, which never preempts.
+    */
+    virtual bool should_preempt(ThreadHandle /*running*/, int64_t /*running_left*/, ThreadHandle /*ready*/) { return false; }
+
+    /*
+        advance_time(time):
+            Called with the current time whenever the dispatcher is about to ask for the next thread,
+            for algorithms whose choice changes with time alone, like a periodic boost. Time never goes
+            backwards. The default does nothing.
+    */
+    virtual void advance_time(int64_t /*time*/) {}
 
     /*
         size():
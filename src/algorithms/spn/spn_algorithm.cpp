@@ -0,0 +1,39 @@
+#include "algorithms/spn/spn_algorithm.hpp"
+
+/*
+    The shortest process next (SPN) scheduling algorithm -- runs the ready thread with the shortest next CPU burst.
+*/
+
+SPNScheduler::SPNScheduler(const ThreadTable& threads, int64_t slice) : threads(threads), reason(RUN_SHORTEST_BURST) {
+	if (slice != -1) {
+		throw("SPN must have a timeslice of -1");
+	}
+}
+
+SPNScheduler::SPNScheduler(const ThreadTable& threads, DecisionReason reason) : threads(threads), reason(reason) {}
+
+SchedulingDecision SPNScheduler::get_next_thread() {
+	size_t rq_size = size();
+	SchedulingDecision sd;
+	if (rq_size > 0) {
+		ThreadHandle next_thr = ready_queue.top().thread;
+		ready_queue.pop();
+		sd.thread = next_thr;
+		sd.reason = reason;
+		sd.ready_count = (uint32_t)rq_size;
+	} else {
+		sd.thread = NO_THREAD;
+		sd.reason = READY_QUEUE_EMPTY;
+	}
+	return sd;
+}
+
+void SPNScheduler::add_to_ready_queue(ThreadHandle thread) {
+	// A thread's next burst cannot change while it waits, so it is looked up once. A thread
+	// preempted by SRTF comes back with what is left of its burst.
+	ready_queue.push({ threads.get_next_burst(thread, BurstType::CPU), added++, thread });
+}
+
+size_t SPNScheduler::size() const {
+	return ready_queue.size();
+}
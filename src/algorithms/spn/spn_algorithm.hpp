@@ -0,0 +1,86 @@
+#ifndef SPN_ALGORITHM_HPP
+#define SPN_ALGORITHM_HPP
+
+#include <cstdint>
+#include <queue>
+#include <vector>
+#include "algorithms/scheduling_algorithm.hpp"
+
+/*
+    SPNScheduler:
+        A representation of a shortest process next scheduling algorithm. The ready
+        thread with the shortest next CPU burst runs next, to the completion of that burst.
+        Threads with equally long bursts run in the order they became ready.
+
+        This is a derived class from the base scheduling algorithm class.
+
+        The ready queue is a binary heap keyed on the burst length, so adding a thread
+        and picking the next one are both O(log n) in the number of ready threads.
+
+        SRTFScheduler derives from it to share the ready queue.
+*/
+
+class SPNScheduler : public Scheduler {
+public:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	/*
+		ReadyThread:
+			A thread in the ready queue, with the length of (what is left of) its next
+			CPU burst and its place in the order threads became ready, which breaks ties.
+	*/
+	struct ReadyThread {
+		int64_t burst_length;
+		uint64_t order;
+		ThreadHandle thread;
+
+		bool operator>(const ReadyThread& other) const {
+			if (burst_length != other.burst_length) {
+				return burst_length > other.burst_length;
+			}
+			return order > other.order;
+		}
+	};
+
+	std::priority_queue<ReadyThread, std::vector<ReadyThread>, std::greater<ReadyThread>> ready_queue;
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/*
+		SPNScheduler(threads, slice):
+			The scheduler looks up the next CPU burst of each ready thread in 'threads',
+			which must outlive it. SPN is not preemptive, so the slice must be -1.
+	*/
+	SPNScheduler(const ThreadTable& threads, int64_t slice = -1);
+
+	SchedulingDecision get_next_thread();
+
+	void add_to_ready_queue(ThreadHandle thread);
+
+	size_t size() const;
+
+protected:
+	/*
+		SPNScheduler(threads, reason):
+			Creates the scheduler for a derived class, which picks threads the same way but
+			reports them with its own decision reason.
+	*/
+	SPNScheduler(const ThreadTable& threads, DecisionReason reason);
+
+	const ThreadTable& threads;
+
+private:
+	DecisionReason reason;
+
+	/*
+		How many threads have been added so far, to number the next one.
+	*/
+	uint64_t added = 0;
+};
+
+#endif
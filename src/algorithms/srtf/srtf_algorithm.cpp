@@ -0,0 +1,16 @@
+#include "algorithms/srtf/srtf_algorithm.hpp"
+
+/*
+    The shortest remaining time first (SRTF) scheduling algorithm -- runs the ready thread with the least CPU burst left,
+    and preempts it for any thread that becomes ready with less.
+*/
+
+SRTFScheduler::SRTFScheduler(const ThreadTable& threads, int64_t slice) : SPNScheduler(threads, RUN_SHORTEST_REMAINING) {
+	if (slice != -1) {
+		throw("SRTF must have a timeslice of -1");
+	}
+}
+
+bool SRTFScheduler::should_preempt(ThreadHandle /*running*/, int64_t running_left, ThreadHandle ready) {
+	return threads.get_next_burst(ready, BurstType::CPU) < running_left;
+}
@@ -0,0 +1,37 @@
+#ifndef SRTF_ALGORITHM_HPP
+#define SRTF_ALGORITHM_HPP
+
+#include <cstdint>
+#include "algorithms/spn/spn_algorithm.hpp"
+
+/*
+    SRTFScheduler:
+        A representation of a shortest remaining time first scheduling algorithm, the
+        preemptive version of shortest process next. The ready thread with the least left
+        of its next CPU burst runs next, and it is preempted as soon as a thread becomes
+        ready with a shorter burst than what it has left. Ties do not preempt, and threads
+        with equally long bursts run in the order they became ready.
+
+        This is a derived class from SPNScheduler, whose ready queue it shares; it only
+        adds preemption.
+*/
+
+class SRTFScheduler : public SPNScheduler {
+public:
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/*
+		SRTFScheduler(threads, slice):
+			The scheduler looks up the next CPU burst of each ready thread in 'threads',
+			which must outlive it. SRTF only preempts for shorter bursts, so the slice
+			must be -1.
+	*/
+	SRTFScheduler(const ThreadTable& threads, int64_t slice = -1);
+
+	bool should_preempt(ThreadHandle running, int64_t running_left, ThreadHandle ready);
+};
+
+#endif
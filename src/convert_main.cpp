@@ -0,0 +1,51 @@
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <vector>
+
+#include "simulation/simulation.hpp"
+#include "utilities/binary_workload/binary_workload.hpp"
+
+/*
+    cpu-sim-convert:
+        Reads a simulation file (text, or binary to re-write it) and writes it out in
+        the binary workload format, which cpu-sim can then load without parsing.
+*/
+
+static void print_convert_usage() {
+	std::cout << "Usage: cpu-sim-convert input_file output_file\n\n";
+	std::cout << "Converts a simulation file to the binary workload format.\n";
+}
+
+int main(int argc, char** argv) {
+
+	if (argc != 3) {
+		print_convert_usage();
+		return 1;
+	}
+
+	try {
+		Simulation simulation;
+		simulation.read_file(argv[1]);
+
+		std::vector<const Process*> processes;
+		for (auto entry : simulation.processes) {
+			processes.push_back(entry.second);
+		}
+
+		BinaryWorkload::write(argv[2], simulation.thread_switch_overhead, simulation.process_switch_overhead,
+		                      simulation.threads, processes);
+	} catch (...) {
+		try {
+			std::exception_ptr eptr = std::current_exception(); // capture
+			std::rethrow_exception(eptr);
+		} catch(const std::exception &e) {
+			std::cerr << "[Exception] " << e.what() << std::endl;
+		} catch(...) {
+			std::cerr << "[Exception] conversion failed" << std::endl;
+		}
+		return 1;
+	}
+
+	return 0;
+}
@@ -1,15 +1,33 @@
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <thread>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "algorithms/cfs/cfs_algorithm.hpp"
 #include "algorithms/fcfs/fcfs_algorithm.hpp"
+#include "algorithms/mlfq/mlfq_algorithm.hpp"
+#include "algorithms/priority/priority_algorithm.hpp"
 #include "algorithms/rr/rr_algorithm.hpp"
+#include "algorithms/spn/spn_algorithm.hpp"
+#include "algorithms/srtf/srtf_algorithm.hpp"
 
 #include "simulation/simulation.hpp"
+#include "types/event_queue/heap/heap_event_queue.hpp"
+#include "types/event_queue/radix/radix_event_queue.hpp"
 #include "types/enums.hpp"
 
+#include "utilities/checked_sum/checked_sum.hpp"
 #include "utilities/flags/flags.hpp"
+#include "utilities/fmt/format.h"
+#include "utilities/gzip_reader/gzip_reader.hpp"
+#include "utilities/parallel_tokenizer/parallel_tokenizer.hpp"
+#include "utilities/stream_reader/stream_reader.hpp"
 
-Simulation::Simulation(FlagOptions flags)
+Simulation::Simulation(FlagOptions flags) : processes(ProcessMap::allocator_type(arena))
 {
 	// Hello!
 	if (flags.scheduler == "FCFS")
@@ -26,70 +44,76 @@ Simulation::Simulation(FlagOptions flags)
 			this->scheduler = std::make_shared<RRScheduler>();
 		}
 	}
+	else if (flags.scheduler == "SPN")
+	{
+		// Create a SPN scheduling algorithm, which needs to see the threads' bursts
+		this->scheduler = std::make_shared<SPNScheduler>(this->threads);
+	}
+	else if (flags.scheduler == "SRTF")
+	{
+		// Create a SRTF scheduling algorithm, which preempts for threads with shorter bursts
+		this->scheduler = std::make_shared<SRTFScheduler>(this->threads);
+	}
+	else if (flags.scheduler == "PRIORITY")
+	{
+		// Create a priority scheduling algorithm, preemptive if asked for
+		this->scheduler = std::make_shared<PriorityScheduler>(this->threads, flags.preempt);
+	}
+	else if (flags.scheduler == "MLFQ")
+	{
+		// Create a MLFQ scheduling algorithm, with the top level's slice defaulting to RR's
+		int64_t slice = (flags.time_slice > -1) ? flags.time_slice : 3;
+		this->scheduler = std::make_shared<MLFQScheduler>(this->threads, flags.levels, slice, flags.boost_interval);
+	}
+	else if (flags.scheduler == "CFS")
+	{
+		// Create a CFS scheduling algorithm, where the time slice sets the target latency
+		if (flags.time_slice > -1) {
+			this->scheduler = std::make_shared<CFSScheduler>(this->threads, flags.time_slice);
+		} else {
+			this->scheduler = std::make_shared<CFSScheduler>(this->threads);
+		}
+	}
+	if (flags.event_queue == "RADIX")
+	{
+		this->events = std::make_shared<RadixEventQueue>();
+	}
+	else
+	{
+		this->events = std::make_shared<HeapEventQueue>();
+	}
 	this->flags = flags;
+	this->fast_forward = flags.fast_forward && flags.scheduler == "RR";
 	this->logger = Logger(flags.verbose, flags.per_thread, flags.metrics);
-	for (auto i = 0; i < 4; i++)
-		this->all_threads[i] = std::vector<std::shared_ptr<Thread>>();
 }
 
 void Simulation::run()
 {
 	this->read_file(this->flags.filename);
 
-	bool first_event = true;
-	while (!this->events.empty())
+	while (this->has_pending_events())
 	{
-		auto event = this->events.top();
-		this->events.pop();
-
-		// Invoke the appropriate method in the simulation for the given event type.
-
-		switch (event->type)
+		Event event = this->next_event();
+		if (!this->cancelled_events.empty() && this->cancelled_events.erase(event.event_num))
 		{
-		case THREAD_ARRIVED:
-			if (first_event) {
-				first_event = false;
-				this->system_stats.total_idle_time = event->time;
-			}
-			this->handle_thread_arrived(event);
-			break;
-
-		case THREAD_DISPATCH_COMPLETED:
-		case PROCESS_DISPATCH_COMPLETED:
-			this->handle_dispatch_completed(event);
-			break;
-
-		case CPU_BURST_COMPLETED:
-			this->handle_cpu_burst_completed(event);
-			break;
-
-		case IO_BURST_COMPLETED:
-			this->handle_io_burst_completed(event);
-			break;
-		case THREAD_COMPLETED:
-			this->handle_thread_completed(event);
-			break;
-
-		case THREAD_PREEMPTED:
-			this->handle_thread_preempted(event);
-			break;
-
-		case DISPATCHER_INVOKED:
-			this->handle_dispatcher_invoked(event);
-			break;
+			continue;
 		}
+		this->process_event(event);
 
-		// If this event triggered a state change, print it out.
-		if (event->thread && event->thread->current_state != event->thread->previous_state)
-		{
-			this->logger.print_state_transition(event, event->thread->previous_state, event->thread->current_state);
-		}
-		else if (event->type == EventType::DISPATCHER_INVOKED)
+		// Run a same-time dispatcher invocation inline, unless an event that was
+		// created before it is still due at that time and must be handled first.
+		while (this->pending_dispatch)
 		{
-			this->logger.print_verbose(event, event->thread, event->scheduling_decision->explanation);
+			if (this->has_pending_events() && this->next_event_time() <= this->pending_dispatch->time)
+			{
+				this->events->push(std::move(*this->pending_dispatch));
+				this->pending_dispatch.reset();
+				break;
+			}
+			Event dispatch = std::move(*this->pending_dispatch);
+			this->pending_dispatch.reset();
+			this->process_event(dispatch);
 		}
-		this->system_stats.total_time = event->time;
-		event.reset();
 	}
 	// We are done!
 
@@ -97,329 +121,772 @@ void Simulation::run()
 
 	for (auto entry : this->processes)
 	{
-		this->logger.print_per_thread_metrics(entry.second);
+		this->logger.print_per_thread_metrics(this->threads, entry.second);
 	}
 
 	this->logger.print_simulation_metrics(this->calculate_statistics());
+
+	this->processes.clear();
+	this->arena.release();
+}
+
+void Simulation::process_event(Event& event)
+{
+	this->current_time = event.time;
+
+	// Invoke the appropriate method in the simulation for the given event type.
+
+	switch (event.type)
+	{
+	case THREAD_ARRIVED:
+		if (this->first_event) {
+			this->first_event = false;
+			this->system_stats.total_idle_time = event.time;
+		}
+		this->handle_thread_arrived(event);
+		break;
+
+	case THREAD_DISPATCH_COMPLETED:
+	case PROCESS_DISPATCH_COMPLETED:
+		this->handle_dispatch_completed(event);
+		break;
+
+	case CPU_BURST_COMPLETED:
+		this->handle_cpu_burst_completed(event);
+		break;
+
+	case IO_BURST_COMPLETED:
+		this->handle_io_burst_completed(event);
+		break;
+	case THREAD_COMPLETED:
+		this->handle_thread_completed(event);
+		break;
+
+	case THREAD_PREEMPTED:
+		this->handle_thread_preempted(event);
+		break;
+
+	case DISPATCHER_INVOKED:
+		this->handle_dispatcher_invoked(event);
+		break;
+	}
+
+	// If this event triggered a state change, print it out.
+	if (event.thread != NO_THREAD && threads.current_state[event.thread] != threads.previous_state[event.thread])
+	{
+		this->logger.print_state_transition(threads, event, threads.previous_state[event.thread], threads.current_state[event.thread]);
+	}
+	else if (event.type == EventType::DISPATCHER_INVOKED && this->logger.verbose)
+	{
+		this->logger.print_verbose(threads, event, event.thread, event.scheduling_decision.explanation());
+	}
+	this->system_stats.total_time = event.time;
 }
 
 //==============================================================================
 // Event-handling methods
 //==============================================================================
 
-void Simulation::handle_thread_arrived(const std::shared_ptr<Event> event)
+void Simulation::handle_thread_arrived(Event& event)
 {
 	// set event thread ready
-	event->thread->set_ready(event->time);
+	threads.set_ready(event.thread, event.time);
 	// increase stats
-	this->system_stats.thread_counts[event->thread->priority]++;
-	this->all_threads[event->thread->priority].emplace_back(event->thread);
+	this->system_stats.thread_counts[threads.priority[event.thread]]++;
 	// schedule thread
-	scheduler->add_to_ready_queue(event->thread);
-	if (active_thread != nullptr) {
+	scheduler->add_to_ready_queue(event.thread);
+	if (active_thread != NO_THREAD) {
+		check_preemption(event.thread, event.time);
 		return;
 	} else {
-		std::shared_ptr<Event> next_event = std::make_shared<Event>(
+		add_event(Event(
 			EventType::DISPATCHER_INVOKED,
-			event->time,
+			event.time,
 			event_num++,
-			event->thread,
-			nullptr
-			);
-		add_event(next_event);
+			event.thread,
+			NO_SCHEDULING_DECISION
+			));
 	}
 }
 
-void Simulation::handle_dispatch_completed(const std::shared_ptr<Event> event)
+void Simulation::handle_dispatch_completed(Event& event)
 {
 	// with the active thread now loaded, set it to running
-	event->thread->set_running(event->time);
-	std::shared_ptr<Burst> burst = event->thread->get_next_burst(BurstType::CPU);
+	threads.set_running(event.thread, event.time);
+	running_burst_thread = NO_THREAD;
+	int64_t burst_length = threads.get_next_burst(event.thread, BurstType::CPU);
 	// handle time slicing, if scheduling algorithm supports it
-	if ( (event->scheduling_decision->time_slice != -1) && (burst->length > event->scheduling_decision->time_slice) ) {
-		int ts = event->scheduling_decision->time_slice;
-		burst->length -= ts;
-		event->thread->service_time += ts;
+	if ( (event.scheduling_decision.time_slice != -1) && (burst_length > event.scheduling_decision.time_slice) ) {
+		if (this->fast_forward && this->fast_forward_slices(event, burst_length)) {
+			return;
+		}
+		int64_t ts = event.scheduling_decision.time_slice;
+		threads.update_burst_time(event.thread, ts);
+		threads.service_time[event.thread] += ts;
 		this->system_stats.service_time += ts;
-		std::shared_ptr<Event> next_event = std::make_shared<Event>(
+		add_event(Event(
 			EventType::THREAD_PREEMPTED,
-			event->time + ts,
+			event.time + ts,
 			event_num++,
-			event->thread,
-			event->scheduling_decision
-			);
-		io_time_start = event->time; // for handling idle times if CPU becomes idle
-		add_event(next_event);
-		next_event = std::make_shared<Event>(
+			event.thread,
+			event.scheduling_decision
+			));
+		io_time_start = event.time; // for handling idle times if CPU becomes idle
+		add_event(Event(
 			EventType::DISPATCHER_INVOKED,
-			event->time + event->scheduling_decision->time_slice,
+			event.time + event.scheduling_decision.time_slice,
 			event_num++,
-			event->thread,
-			nullptr
-		);
-		add_event(next_event);
+			event.thread,
+			NO_SCHEDULING_DECISION
+		));
 		return;
 	}
-	burst = event->thread->pop_next_burst(BurstType::CPU);
-	// complete CPU burst
-	event->thread->service_time += burst->length;
-	this->system_stats.service_time += burst->length;
-	std::shared_ptr<Event> next_event;
-	if (event->thread->get_next_burst(BurstType::IO) == nullptr) {
-		next_event = std::make_shared<Event>(
+	burst_length = threads.pop_next_burst(event.thread, BurstType::CPU);
+	// complete CPU burst, unless the thread is preempted before then
+	threads.service_time[event.thread] += burst_length;
+	this->system_stats.service_time += burst_length;
+	running_burst_thread = event.thread;
+	running_burst_event = event_num;
+	running_burst_end = event.time + burst_length;
+	if (!threads.has_next_burst(event.thread)) {
+		add_event(Event(
 			EventType::THREAD_COMPLETED,
-			event->time + burst->length,
+			event.time + burst_length,
 			event_num++,
-			event->thread,
-			nullptr
-			);
+			event.thread,
+			NO_SCHEDULING_DECISION
+			));
 	} else {
-		next_event = std::make_shared<Event>(
+		add_event(Event(
 			EventType::CPU_BURST_COMPLETED,
-			event->time + burst->length,
+			event.time + burst_length,
 			event_num++,
-			event->thread,
-			nullptr
-		);
+			event.thread,
+			NO_SCHEDULING_DECISION
+		));
 	}
-	add_event(next_event);
 }
 
-void Simulation::handle_cpu_burst_completed(const std::shared_ptr<Event> event)
+void Simulation::handle_cpu_burst_completed(Event& event)
 {
 	// first, block the thread
-	event->thread->set_blocked(event->time);
+	threads.set_blocked(event.thread, event.time);
 	// next, complete an I/O burst
-	std::shared_ptr<Burst> io_burst = event->thread->pop_next_burst(BurstType::IO);
-	event->thread->io_time += io_burst->length;
-	this->system_stats.io_time += io_burst->length;
-	std::shared_ptr<Event> next_event = std::make_shared<Event>(
+	int64_t io_length = threads.pop_next_burst(event.thread, BurstType::IO);
+	threads.io_time[event.thread] += io_length;
+	this->system_stats.io_time += io_length;
+	add_event(Event(
 		EventType::IO_BURST_COMPLETED,
-		event->time + io_burst->length,
+		event.time + io_length,
 		event_num++,
-		event->thread,
-		nullptr
-		);
-	io_time_start = event->time;
-	add_event(next_event);
-	next_event = nullptr;
+		event.thread,
+		NO_SCHEDULING_DECISION
+		));
+	io_time_start = event.time;
 	// now that it will go do an I/O burst, we may have time for someone else to do something
-	next_event = std::make_shared<Event>(
+	add_event(Event(
 		EventType::DISPATCHER_INVOKED,
-		event->time,
+		event.time,
 		event_num++,
-		nullptr,
-		nullptr
-	);
-	add_event(next_event);
+		NO_THREAD,
+		NO_SCHEDULING_DECISION
+	));
 }
 
-void Simulation::handle_io_burst_completed(const std::shared_ptr<Event> event)
+void Simulation::handle_io_burst_completed(Event& event)
 {
 	// the thread can begin executing again when told to do so
-	event->thread->set_ready(event->time);
-	scheduler->add_to_ready_queue(event->thread);
-	if (active_thread != nullptr) {
+	threads.set_ready(event.thread, event.time);
+	scheduler->add_to_ready_queue(event.thread);
+	if (active_thread != NO_THREAD) {
+		check_preemption(event.thread, event.time);
 		return; // if there is work being done
 	} else {
 		// add time CPU spent idle to stats
-		this->system_stats.total_idle_time += event->time - io_time_start;
+		this->system_stats.total_idle_time += event.time - io_time_start;
 	}
-	std::shared_ptr<Event> next_event = std::make_shared<Event>(
+	add_event(Event(
 		EventType::DISPATCHER_INVOKED,
-		event->time,
+		event.time,
 		event_num++,
-		nullptr,
-		nullptr
-		);
-	add_event(next_event);
+		NO_THREAD,
+		NO_SCHEDULING_DECISION
+		));
 }
 
-void Simulation::handle_thread_completed(const std::shared_ptr<Event> event)
+void Simulation::handle_thread_completed(Event& event)
 {
-	event->thread->set_finished(event->time);
+	threads.set_finished(event.thread, event.time);
 	prev_thread = active_thread;
-	active_thread = nullptr;
+	active_thread = NO_THREAD;
 	if (scheduler->empty()) {
 		return;
 	}
 	// invoke dispatcher once more
-	std::shared_ptr<Event> next_event = std::make_shared<Event>(
+	add_event(Event(
 		EventType::DISPATCHER_INVOKED,
-		event->time,
+		event.time,
 		event_num++,
-		nullptr,
-		nullptr
-	);
-	add_event(next_event);
+		NO_THREAD,
+		NO_SCHEDULING_DECISION
+	));
 }
 
-void Simulation::handle_thread_preempted(const std::shared_ptr<Event> event)
+void Simulation::handle_thread_preempted(Event& event)
 {
 	// return thread to READY status
-	event->thread->set_ready(event->time);
-	scheduler->add_to_ready_queue(event->thread);
+	threads.set_ready(event.thread, event.time);
+	scheduler->add_to_ready_queue(event.thread);
 	// update stats from partially-completed CPU burst
-	std::shared_ptr<Burst> cpu_burst = event->thread->get_next_burst(BurstType::CPU);
-	int time_spent = event->time - event->thread->state_change_time;
-	event->thread->service_time += time_spent;
+	threads.get_next_burst(event.thread, BurstType::CPU);
+	int64_t time_spent = event.time - threads.state_change_time[event.thread];
+	threads.service_time[event.thread] += time_spent;
 	this->system_stats.service_time += time_spent;
 	// shorten burst, then check invoker
-	cpu_burst->update_time(time_spent);
-	if (active_thread != nullptr) {
+	threads.update_burst_time(event.thread, time_spent);
+	if (active_thread != NO_THREAD) {
 		return; // if there is work being done
 	} else {
 		// handle preempted thread CPU idle time
-		this->system_stats.total_idle_time += event->time - io_time_start;
+		this->system_stats.total_idle_time += event.time - io_time_start;
 	}
-	std::shared_ptr<Event> next_event = std::make_shared<Event>(
+	add_event(Event(
 		EventType::DISPATCHER_INVOKED,
-		event->time,
+		event.time,
 		event_num++,
-		event->thread,
-		nullptr
-	);
-	add_event(next_event);
+		event.thread,
+		NO_SCHEDULING_DECISION
+	));
 }
 
-void Simulation::handle_dispatcher_invoked(const std::shared_ptr<Event> event)
+void Simulation::handle_dispatcher_invoked(Event& event)
 {
 	// save current thread if cpu not idle
-	if (active_thread != nullptr) {
+	if (active_thread != NO_THREAD) {
 		prev_thread = active_thread;
 	}
 	// try get next thread from scheduler
-	std::shared_ptr<SchedulingDecision> sd = scheduler->get_next_thread();
-	event->scheduling_decision = sd;
-	event->thread = sd->thread;
-	if (sd->thread == nullptr) {
-		active_thread = nullptr; // no next thread, cpu idle
+	scheduler->advance_time(event.time);
+	event.scheduling_decision = scheduler->get_next_thread();
+	const SchedulingDecision& sd = event.scheduling_decision;
+	event.thread = sd.thread;
+	if (sd.thread == NO_THREAD) {
+		active_thread = NO_THREAD; // no next thread, cpu idle
 		return;
 	}
-	active_thread = sd->thread;
+	active_thread = sd.thread;
 
 	// check if current and previous threads are from same process
-	std::shared_ptr<Event> next_event;
-	if ((prev_thread != nullptr) && (active_thread->process_id == prev_thread->process_id)) {
-		next_event = std::make_shared<Event>(
+	if ((prev_thread != NO_THREAD) && (threads.process_id[active_thread] == threads.process_id[prev_thread])) {
+		add_event(Event(
 			EventType::THREAD_DISPATCH_COMPLETED,
-			event->time + thread_switch_overhead,
+			event.time + thread_switch_overhead,
 			event_num++,
-			sd->thread,
+			sd.thread,
 			sd
-			);
+			));
 		this->system_stats.dispatch_time += thread_switch_overhead;
 	} else {
-		next_event = std::make_shared<Event>(
+		add_event(Event(
 			EventType::PROCESS_DISPATCH_COMPLETED,
-			event->time + process_switch_overhead,
+			event.time + process_switch_overhead,
 			event_num++,
-			sd->thread,
+			sd.thread,
 			sd
-			);
+			));
 		this->system_stats.dispatch_time += process_switch_overhead;
 	}
-	add_event(next_event);
 }
 
 //==============================================================================
 // Utility methods
 //==============================================================================
 
+void Simulation::check_preemption(ThreadHandle thread, uint64_t time)
+{
+	// Only the active thread's burst can be cut short, while it runs and is not about to end anyway.
+	ThreadHandle running = running_burst_thread;
+	if (running != active_thread || threads.current_state[running] != ThreadState::RUNNING || running_burst_end <= time) {
+		return;
+	}
+	int64_t left = (int64_t)(running_burst_end - time);
+	if (!scheduler->should_preempt(running, left, thread)) {
+		return;
+	}
+
+	// The whole burst was accounted for when it was dispatched; give back what did not run.
+	threads.cut_burst(running, left);
+	threads.service_time[running] -= left;
+	this->system_stats.service_time -= left;
+	cancelled_events.insert(running_burst_event);
+	running_burst_thread = NO_THREAD;
+
+	add_event(Event(
+		EventType::THREAD_PREEMPTED,
+		time,
+		event_num++,
+		running,
+		NO_SCHEDULING_DECISION
+		));
+	add_event(Event(
+		EventType::DISPATCHER_INVOKED,
+		time,
+		event_num++,
+		running,
+		NO_SCHEDULING_DECISION
+		));
+}
+
+bool Simulation::fast_forward_slices(Event& event, int64_t burst_length)
+{
+	// With other threads ready, the preempted thread would not be re-dispatched right away.
+	if (!scheduler->empty()) {
+		return false;
+	}
+
+	ThreadHandle thread = event.thread;
+	int64_t ts = event.scheduling_decision.time_slice;
+	int64_t start = event.time;
+
+	// Every cycle preempts the thread after ts and re-dispatches it at the same time. If the CPU
+	// is already marked idle, the preemption also counts the slice as idle time and invokes a second
+	// dispatcher that finds nothing, so the CPU stays marked idle for the next cycle as well.
+	bool idle = (active_thread == NO_THREAD);
+	ThreadHandle first_prev = idle ? prev_thread : active_thread;
+	bool first_same_process = (first_prev != NO_THREAD) && (threads.process_id[first_prev] == threads.process_id[thread]);
+	int64_t first_cycle = ts + (first_same_process ? thread_switch_overhead : process_switch_overhead);
+	int64_t cycle = ts + thread_switch_overhead;
+
+	// Every sliced cycle takes ts off the burst, so this many cycles start with more than a slice left.
+	int64_t cycles = (burst_length - 1) / ts;
+
+	// A cycle can only be skipped if nothing else happens up to and including its preemption.
+	if (this->has_pending_events()) {
+		int64_t next_time = this->next_event_time();
+		if (next_time <= start + ts) {
+			return false;
+		}
+		int64_t later_window = next_time - start - first_cycle - ts;
+		int64_t later_cycles = (later_window > 0) ? (later_window + cycle - 1) / cycle : 0;
+		cycles = std::min(cycles, 1 + later_cycles);
+	}
+
+	int64_t end = start + first_cycle + (cycles - 1) * cycle;
+	int64_t last_start = (cycles == 1) ? start : end - cycle;
+
+	int64_t service = ts * cycles;
+	threads.update_burst_time(thread, service);
+	threads.service_time[thread] += service;
+	this->system_stats.service_time += service;
+	this->system_stats.dispatch_time += (first_cycle - ts) + (cycles - 1) * thread_switch_overhead;
+	if (idle) {
+		this->system_stats.total_idle_time += service;
+	}
+
+	io_time_start = last_start;
+	threads.set_ready(thread, last_start + ts);
+	if (idle) {
+		prev_thread = thread;
+	} else {
+		prev_thread = (cycles == 1) ? active_thread : thread;
+		active_thread = thread;
+	}
+
+	bool same_process = (cycles > 1) || first_same_process;
+	add_event(Event(
+		same_process ? EventType::THREAD_DISPATCH_COMPLETED : EventType::PROCESS_DISPATCH_COMPLETED,
+		end,
+		event_num++,
+		thread,
+		event.scheduling_decision
+		));
+	return true;
+}
+
 SystemStats Simulation::calculate_statistics()
 {
 	// TODO: Implement functionality for calculating the simulation statistics
 	this->system_stats.cpu_utilization =
-		100.0 * (1.0 - ((float)this->system_stats.total_idle_time / (float)this->system_stats.total_time));
+		100.0 * (1.0 - ((double)this->system_stats.total_idle_time / (double)this->system_stats.total_time));
 	this->system_stats.cpu_efficiency  =
-		100.0 * ((float)this->system_stats.service_time / (float)this->system_stats.total_time);
-	// compute average stats
-	int resp_totals[4] = {0};
-	int turn_totals[4] = {0};
+		100.0 * ((double)this->system_stats.service_time / (double)this->system_stats.total_time);
+	// compute average stats in one pass over the thread table
+	std::vector<CheckedSum> resp_totals(4, CheckedSum("response times"));
+	std::vector<CheckedSum> turn_totals(4, CheckedSum("turnaround times"));
+	for (ThreadHandle thread = 0; thread < threads.size(); thread++) {
+		ProcessPriority priority = threads.priority[thread];
+		resp_totals[priority].add(threads.response_time(thread));
+		turn_totals[priority].add(threads.turnaround_time(thread));
+	}
 	for (int i = 0; i < 4; i++) {
-		int thr_counts = system_stats.thread_counts[i];
-		for (auto thread : this->all_threads[i]) {
-			resp_totals[i] += thread->response_time();
-			turn_totals[i] += thread->turnaround_time();
-		}
-		system_stats.avg_thread_response_times[i] =
-			(thr_counts != 0) ? (float)resp_totals[i] / (float)thr_counts : 0.0;
-		system_stats.avg_thread_turnaround_times[i] =
-			(thr_counts != 0) ? (float)turn_totals[i] / (float)thr_counts : 0.0;
+		size_t thr_counts = system_stats.thread_counts[i];
+		system_stats.avg_thread_response_times[i] = resp_totals[i].mean(thr_counts);
+		system_stats.avg_thread_turnaround_times[i] = turn_totals[i].mean(thr_counts);
 	}
 
 	return this->system_stats;
 }
 
-void Simulation::add_event(std::shared_ptr<Event> event)
+bool Simulation::has_pending_events() const
 {
-	if (event != nullptr)
+	return !this->events->empty() || !this->arrivals.empty();
+}
+
+bool Simulation::arrival_is_next() const
+{
+	if (this->arrivals.empty()) {
+		return false;
+	}
+	if (this->events->empty()) {
+		return true;
+	}
+	// Arrivals come first at equal times. Read up front, they are numbered before any
+	// other event anyway; streamed in later, they still have to be.
+	return this->arrivals.peek().time <= this->events->top().time;
+}
+
+uint64_t Simulation::next_event_time() const
+{
+	return this->arrival_is_next() ? this->arrivals.peek().time : this->events->top().time;
+}
+
+Event Simulation::next_event()
+{
+	if (!this->arrival_is_next())
 	{
-		this->events.push(event);
+		return this->events->pop();
 	}
+	Event arrival = this->arrivals.pop();
+	if (this->stream_input && this->arrivals.size() <= STREAM_LOOKAHEAD / 2)
+	{
+		// Top up in batches; a batch is read before the simulation moves past this arrival.
+		this->stream_horizon = arrival.time;
+		this->read_stream();
+	}
+	return arrival;
+}
+
+void Simulation::add_event(Event event)
+{
+	if (this->flags.inline_dispatch && !this->pending_dispatch &&
+		event.type == EventType::DISPATCHER_INVOKED && event.time == this->current_time)
+	{
+		this->pending_dispatch = std::move(event);
+		return;
+	}
+	this->events->push(std::move(event));
+}
+
+// zstd frames start with 28 B5 2F FD.
+static bool is_zstd(const char* data, size_t size)
+{
+	return size >= 4 && (unsigned char)data[0] == 0x28 && (unsigned char)data[1] == 0xb5 &&
+	       (unsigned char)data[2] == 0x2f && (unsigned char)data[3] == 0xfd;
+}
+
+static bool is_compressed(const char* data, size_t size)
+{
+	return GzipReader::is_gzip(data, size) || is_zstd(data, size);
 }
 
 void Simulation::read_file(const std::string filename)
 {
-	std::ifstream input_file(filename.c_str());
+	bool from_stdin = (filename == "-" || filename == "");
+	bool mapped = !from_stdin && this->input_file.open(filename);
+	if (mapped && is_compressed(this->input_file.data(), this->input_file.size()))
+	{
+		// Compressed files are decompressed as they are read, never inflated whole.
+		this->input_file.close();
+		mapped = false;
+	}
+	if (!mapped)
+	{
+		// stdin, pipes and anything else that cannot be mapped are read as a stream.
+		int fd = from_stdin ? STDIN_FILENO : ::open(filename.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+		std::cerr << "Unable to open simulation file: " << filename << std::endl;
+		throw(std::logic_error("Bad file."));
+		}
+		this->input_stream = std::make_unique<StreamReader>(fd, !from_stdin);
+		this->read_piped_file();
+		return;
+	}
 
-	if (!input_file)
+	if (BinaryWorkload::is_binary_workload(this->input_file.data(), this->input_file.size()))
 	{
-	std::cerr << "Unable to open simulation file: " << filename << std::endl;
-	throw(std::logic_error("Bad file."));
+		this->read_binary_workload(BinaryWorkload(this->input_file.data(), this->input_file.size()));
+		this->arrivals.seal();
+		return;
 	}
 
-	int num_processes;
+	if (this->flags.stream)
+	{
+		this->stream_input.emplace(this->input_file.begin(), this->input_file.end());
+		this->begin_streaming();
+		return;
+	}
 
-	input_file >> num_processes >> this->thread_switch_overhead >> this->process_switch_overhead;
+	std::unique_ptr<ParseCache> cache;
+	if (!this->flags.cache_dir.empty())
+	{
+		cache = std::make_unique<ParseCache>(this->flags.cache_dir);
+		size_t workload_size = 0;
+		const char* workload = cache->load(filename, this->input_file, this->cache_file, workload_size);
+		if (workload != nullptr)
+		{
+			this->read_binary_workload(BinaryWorkload(workload, workload_size));
+			this->input_file.close();
+			this->arrivals.seal();
+			return;
+		}
+	}
+
+	// Large files are tokenized on every core while they are being read.
+	unsigned jobs = (this->flags.parse_jobs > 0) ? (unsigned)this->flags.parse_jobs : std::thread::hardware_concurrency();
+	std::unique_ptr<ParallelTokenizer> tokenizer;
+	if (jobs > 1 && this->input_file.size() >= 2 * ParallelTokenizer::DEFAULT_CHUNK_SIZE)
+	{
+		tokenizer = std::make_unique<ParallelTokenizer>(this->input_file.begin(), this->input_file.end(), jobs);
+	}
+	IntScanner input(this->input_file.begin(), this->input_file.end(), tokenizer.get());
+	this->read_text(input);
+
+	if (cache)
+	{
+		std::vector<const Process*> processes;
+		for (auto entry : this->processes)
+		{
+			processes.push_back(entry.second);
+		}
+		cache->store(filename, this->input_file, this->thread_switch_overhead, this->process_switch_overhead,
+		             this->threads, processes);
+	}
+
+	// Everything has been copied out of the text, so the mapping is no longer needed.
+	// The workers may still be reading chunks ahead, so they have to stop first.
+	tokenizer.reset();
+	this->input_file.close();
+	this->arrivals.seal();
+}
+
+void Simulation::read_piped_file()
+{
+	const char* head;
+	size_t head_size = this->input_stream->peek(head, sizeof(BinaryWorkloadHeader));
+	if (GzipReader::is_gzip(head, head_size))
+	{
+		// The input is inflated on another thread while it is being parsed.
+		this->input_stream = std::make_unique<GzipReader>(std::move(this->input_stream));
+		head_size = this->input_stream->peek(head, sizeof(BinaryWorkloadHeader));
+	}
+	else if (is_zstd(head, head_size))
+	{
+		throw std::runtime_error("Unsupported simulation file: zstd-compressed input is not supported yet, "
+		                         "decompress it first (e.g. 'zstd -dc file | cpu-sim -')");
+	}
+
+	if (BinaryWorkload::is_binary_workload(head, head_size))
+	{
+		// A binary workload is used in place, so it has to be read whole.
+		this->input_stream->read_all(this->input_bytes);
+		this->input_stream.reset();
+		this->read_binary_workload(BinaryWorkload(this->input_bytes.data(), this->input_bytes.size()));
+		this->arrivals.seal();
+		return;
+	}
+
+	if (this->flags.stream)
+	{
+		this->stream_input.emplace(*this->input_stream);
+		this->begin_streaming();
+		return;
+	}
+
+	IntScanner input(*this->input_stream);
+	this->read_text(input);
+	this->input_stream.reset();
+	this->arrivals.seal();
+}
+
+void Simulation::read_text(IntScanner& input)
+{
+	int num_processes = (int)input.next_int("the number of processes");
+	this->thread_switch_overhead = input.next_int("the thread switch overhead");
+	this->process_switch_overhead = input.next_int("the process switch overhead");
 
 	for (int proc = 0; proc < num_processes; ++proc)
 	{
-		auto process = read_process(input_file);
+		auto process = read_process(input);
 
 		this->processes[process->process_id] = process;
 	}
 }
 
-std::shared_ptr<Process> Simulation::read_process(std::istream &input)
+void Simulation::read_binary_workload(const BinaryWorkload& workload)
 {
-	int process_id, priority;
-	int num_threads;
+	const BinaryWorkloadHeader& header = *workload.header;
+	this->thread_switch_overhead = header.thread_switch_overhead;
+	this->process_switch_overhead = header.process_switch_overhead;
 
-	input >> process_id >> priority >> num_threads;
+	this->threads.reserve(header.num_threads);
+	this->threads.attach_bursts(workload.bursts, header.num_bursts);
+	for (uint64_t i = 0; i < header.num_threads; ++i)
+	{
+		const BinaryThreadRecord& record = workload.threads[i];
+		ThreadHandle thread = this->threads.add(record.arrival_time, record.thread_id, record.process_id, (ProcessPriority)record.priority);
+		this->threads.set_bursts(thread, record.first_burst, record.num_bursts);
 
-	auto process = std::make_shared<Process>(process_id, (ProcessPriority)priority);
+		this->arrivals.add(Event(EventType::THREAD_ARRIVED, record.arrival_time, this->event_num, thread, NO_SCHEDULING_DECISION));
+		this->event_num++;
+	}
 
-	// iterate over the threads
-	for (int thread_id = 0; thread_id < num_threads; ++thread_id)
+	for (uint64_t i = 0; i < header.num_processes; ++i)
 	{
-		process->threads.emplace_back(read_thread(input, thread_id, process_id, (ProcessPriority)priority));
+		const BinaryProcessRecord& record = workload.processes[i];
+		Process* process = this->arena.make<Process>(record.process_id, (ProcessPriority)record.priority);
+		process->threads.reserve(record.num_threads);
+		for (uint32_t n = 0; n < record.num_threads; ++n)
+		{
+			process->threads.push_back(record.first_thread + n);
+		}
+		this->processes[process->process_id] = process;
 	}
+}
 
-	return process;
+Process* Simulation::read_process_header(IntScanner &input, int& num_threads)
+{
+	int process_id = (int)input.next_int("a process ID");
+	size_t offset = input.offset();
+	int64_t priority = input.next_int("a process priority");
+	if (priority < SYSTEM || priority > BATCH)
+	{
+		throw std::runtime_error(fmt::format(
+			"Malformed simulation file at byte {}: process {} has an invalid priority", offset, process_id));
+	}
+	num_threads = (int)input.next_int("a process's number of threads");
+
+	return this->arena.make<Process>(process_id, (ProcessPriority)priority);
 }
 
-std::shared_ptr<Thread> Simulation::read_thread(std::istream &input, int thread_id, int process_id, ProcessPriority priority)
+Process* Simulation::read_process(IntScanner &input)
 {
-	// Stuff
-	int arrival_time;
-	int num_cpu_bursts;
+	int num_threads = 0;
+	Process* process = read_process_header(input, num_threads);
 
-	input >> arrival_time >> num_cpu_bursts;
+	// iterate over the threads; a thread template stands for several of them
+	while ((int)process->threads.size() < num_threads)
+	{
+		read_thread(input, process, num_threads - (int)process->threads.size());
+	}
 
-	auto thread = std::make_shared<Thread>(arrival_time, thread_id, process_id, priority);
+	return process;
+}
 
-	for (int n = 0, burst_length; n < num_cpu_bursts * 2 - 1; ++n)
+ThreadHandle Simulation::read_thread(IntScanner &input, Process* process, int threads_left)
+{
+	int thread_id = (int)process->threads.size();
+	int64_t arrival_time = input.next_int("a thread's arrival time");
+	int64_t num_cpu_bursts = input.next_int("a thread's number of CPU bursts");
+
+	// A negative number of CPU bursts starts a thread template instead:
+	// "arrival_time -copies stride num_cpu_bursts", then the bursts every copy has.
+	int64_t copies = 1;
+	int64_t stride = 0;
+	if (num_cpu_bursts < 0)
 	{
-		input >> burst_length;
+		size_t offset = input.offset();
+		copies = -num_cpu_bursts;
+		stride = input.next_int("a thread template's arrival stride");
+		num_cpu_bursts = input.next_int("a thread template's number of CPU bursts");
+		if (copies > threads_left || stride < 0 || num_cpu_bursts <= 0)
+		{
+			throw std::runtime_error(fmt::format(
+				"Malformed simulation file at byte {}: a thread template of process {} must have at most {} copies, "
+				"a stride of at least 0 and at least one CPU burst", offset, process->process_id, threads_left));
+		}
+	}
 
-		BurstType burst_type = (n % 2 == 0) ? BurstType::CPU : BurstType::IO;
+	ThreadHandle thread = this->threads.add(arrival_time, thread_id, process->process_id, process->priority);
+	process->threads.push_back(thread);
+
+	// Bursts alternate CPU, IO, CPU, ..., which the thread table relies on.
+	int64_t remaining = num_cpu_bursts * 2 - 1;
+	while (remaining > 0)
+	{
+		size_t count;
+		const int64_t* lengths = input.next_ints((size_t)remaining, count, "a burst length");
+		this->threads.add_bursts(thread, lengths, (uint32_t)count);
+		remaining -= (int64_t)count;
+	}
+	this->threads.intern_bursts(thread);
 
-		thread->bursts.push(std::make_shared<Burst>(burst_type, burst_length));
+	if (copies == 1)
+	{
+		this->arrivals.add(Event(EventType::THREAD_ARRIVED, arrival_time, this->event_num, thread, NO_SCHEDULING_DECISION));
+		this->event_num++;
+		return thread;
 	}
 
-	this->events.push(std::make_shared<Event>(EventType::THREAD_ARRIVED, thread->arrival_time, this->event_num, thread, nullptr));
-	this->event_num++;
+	// The copies share the template's bursts, and their arrivals are made as they come due.
+	for (int64_t n = 1; n < copies; ++n)
+	{
+		ThreadHandle copy = this->threads.add(arrival_time + n * stride, thread_id + (int)n, process->process_id, process->priority);
+		this->threads.share_bursts(copy, thread);
+		process->threads.push_back(copy);
+	}
+	this->arrivals.add_run(arrival_time, stride, this->event_num, thread, (uint32_t)copies);
+	this->event_num += copies;
 
 	return thread;
 }
+
+void Simulation::begin_streaming()
+{
+	IntScanner& input = *this->stream_input;
+	this->stream_processes_left = (int)input.next_int("the number of processes");
+	this->thread_switch_overhead = input.next_int("the thread switch overhead");
+	this->process_switch_overhead = input.next_int("the process switch overhead");
+	this->arrivals.seal();
+	this->read_stream();
+}
+
+void Simulation::read_stream()
+{
+	IntScanner& input = *this->stream_input;
+
+	while (this->arrivals.size() < STREAM_LOOKAHEAD)
+	{
+		if (this->stream_process == nullptr || (int)this->stream_process->threads.size() == this->stream_process_threads)
+		{
+			if (this->stream_processes_left == 0)
+			{
+				// Everything has been read, so the input is no longer needed.
+				this->stream_input.reset();
+				this->input_file.close();
+				this->input_stream.reset();
+				return;
+			}
+			this->stream_processes_left--;
+
+			this->stream_process = read_process_header(input, this->stream_process_threads);
+			this->processes[this->stream_process->process_id] = this->stream_process;
+			continue;
+		}
+
+		Process* process = this->stream_process;
+		ThreadHandle thread = read_thread(input, process, this->stream_process_threads - (int)process->threads.size());
+
+		int64_t arrival_time = this->threads.arrival_time[thread];
+		if (arrival_time < this->stream_horizon)
+		{
+			throw std::runtime_error(fmt::format(
+				"Cannot stream simulation file: thread {} of process {} arrives at {}, but the simulation "
+				"already reached {}. Threads may be at most {} places out of arrival order.",
+				this->threads.thread_id[thread], process->process_id, arrival_time, this->stream_horizon, STREAM_LOOKAHEAD / 2));
+		}
+	}
+
+	// The integers before the scanner's position have all been read.
+	this->input_file.drop_before(input.offset());
+}
@@ -1,24 +1,35 @@
 #ifndef SIMULATION_HPP
 #define SIMULATION_HPP
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "algorithms/scheduling_algorithm.hpp"
 #include "types/process/process.hpp"
-#include "types/thread/thread.hpp"
+#include "types/thread_table/thread_table.hpp"
 #include "types/system_stats/system_stats.hpp"
 #include "types/event/event.hpp"
+#include "types/event_queue/event_queue.hpp"
+#include "types/arrival_stream/arrival_stream.hpp"
 
+#include "utilities/arena/arena.hpp"
 #include "utilities/flags/flags.hpp"
+#include "utilities/mapped_file/mapped_file.hpp"
+#include "utilities/binary_workload/binary_workload.hpp"
+#include "utilities/int_scanner/int_scanner.hpp"
+#include "utilities/parse_cache/parse_cache.hpp"
+#include "utilities/stream_reader/stream_reader.hpp"
 #include "utilities/logger/logger.hpp"
 
-using EventQueue = std::priority_queue<std::shared_ptr<Event>, std::vector<std::shared_ptr<Event>>, EventComparator>;
-
 /*
 Simulation:
 A class that encapsulates the entire simulation logic. Contains all the member variables
@@ -32,11 +43,56 @@ public:
 	//  Member variables
 	//==================================================
 
+	/**
+	arena:
+	    Owns the objects that live for the whole run: the processes and the nodes of the
+	    process map. They are all released at once at the end of run(). Declared first so
+	    that it outlives everything that points into it.
+	*/
+	Arena arena;
+
+	using ProcessMap = std::map<int, Process*, std::less<int>, ArenaAllocator<std::pair<const int, Process*>>>;
+
 	/**
 	processes:
 	    A map of process IDs to their corresponding process object.
 	*/
-	std::map<int, std::shared_ptr<Process>> processes;
+	ProcessMap processes;
+
+	/**
+	threads:
+	    Every thread read from the simulation file. The rest of the simulation refers
+	    to threads by their handle into this table.
+	*/
+	ThreadTable threads;
+
+	/**
+	input_file:
+	    The memory mapping of the simulation file. A binary workload's bursts are read
+	    straight from it for the whole run.
+	*/
+	MappedFile input_file;
+
+	/**
+	cache_file:
+	    The memory mapping of the parse cache entry the simulation was loaded from, if
+	    any (see --cache_dir). Its bursts are read straight from it for the whole run.
+	*/
+	MappedFile cache_file;
+
+	/**
+	input_stream:
+	    The reader for a simulation file that cannot be mapped, e.g. stdin or a pipe.
+	    Empty once the whole file has been read.
+	*/
+	std::unique_ptr<StreamReader> input_stream;
+
+	/**
+	input_bytes:
+	    A binary workload read from a stream, kept for the whole run since its bursts
+	    are read straight from it.
+	*/
+	std::vector<char> input_bytes;
 
 	/**
 	scheduler:
@@ -50,49 +106,128 @@ public:
 	/**
 	active_thread:
 	    The thread that is currently on the CPU. If no thread is on the
-	    CPU, it should point to nullptr.
+	    CPU, it should be NO_THREAD.
 	*/
-	std::shared_ptr<Thread> active_thread = nullptr;
+	ThreadHandle active_thread = NO_THREAD;
 
 	/**
 	prev_thread:
-	    The thread that was previously on the CPU, or nullptr if there was
+	    The thread that was previously on the CPU, or NO_THREAD if there was
 	    not thread previously on the CPU.
 	*/
-	std::shared_ptr<Thread> prev_thread = nullptr;
+	ThreadHandle prev_thread = NO_THREAD;
 
 	/**
 	io_time_start:
 	    Helper function to keep track of when an I/O burst starts, in order
 	    to determine CPU idle time if CPU bursts didn't occur during this time.
 	 */
-	int io_time_start = 0;
+	int64_t io_time_start = 0;
 
 	/**
 	thread_switch_overhead:
 	    An integer for the thread switch overhead, as specified in the simulation file.
 	*/
-	int thread_switch_overhead;
+	int64_t thread_switch_overhead;
 
 	/**
 	process_switch_overhead:
 	    An integer for the process switch overhead, as specified in the simulation file.
 	*/
-	int process_switch_overhead;
+	int64_t process_switch_overhead;
 
 	/**
 	event_num:
 	    An integer representing how many events that the simulation has created. This is
 	    used in the Event class so that we can break ties in the event queue.
 	*/
-	unsigned int event_num = 0;
+	uint64_t event_num = 0;
 
 	/**
 	events:
 	    Our priority queue of events. This is what we add new events to,
-	    and take events from to progress through the simulation.
+	    and take events from to progress through the simulation. Events are
+	    stored by value inside the queue, and the backend (see EventQueue) is
+	    chosen with the -q, --event_queue flag.
+	*/
+	std::shared_ptr<EventQueue> events;
+
+	/**
+	arrivals:
+	    The THREAD_ARRIVED events read from the simulation file. They are not pushed
+	    into 'events'; next_event() merges the two in (time, event_num) order instead.
+	*/
+	ArrivalStream arrivals;
+
+	/**
+	pending_dispatch:
+	    With the -i, --inline_dispatch flag, a DISPATCHER_INVOKED event created for the
+	    current time is parked here instead of going through the event queue. run()
+	    executes it right after the event that created it, unless an earlier-numbered
+	    event is due at the same time, in which case it is queued as usual.
+	*/
+	std::optional<Event> pending_dispatch;
+
+	/**
+	running_burst_thread, running_burst_event, running_burst_end:
+	    The thread that last started a CPU burst that may be preempted (see
+	    Scheduler::should_preempt), or NO_THREAD, and the event number and time of the
+	    CPU_BURST_COMPLETED or THREAD_COMPLETED event that ends that burst.
+	*/
+	ThreadHandle running_burst_thread = NO_THREAD;
+	uint64_t running_burst_event = 0;
+	uint64_t running_burst_end = 0;
+
+	/**
+	cancelled_events:
+	    The numbers of events that were cancelled while in the event queue, e.g. the end of
+	    a preempted CPU burst. The queue cannot remove them, so run() skips them instead.
+	*/
+	std::unordered_set<uint64_t> cancelled_events;
+
+	/**
+	stream_input:
+	    With the -l, --stream flag, the scanner over the part of the simulation file that
+	    has not been read yet. Empty once the whole file has been read.
+	*/
+	std::optional<IntScanner> stream_input;
+
+	/**
+	stream_process:
+	    While streaming, the process whose threads are being read; it has
+	    stream_process_threads threads in the file. stream_processes_left more
+	    processes follow it.
+	*/
+	Process* stream_process = nullptr;
+	int stream_process_threads = 0;
+	int stream_processes_left = 0;
+
+	/**
+	stream_horizon:
+	    While streaming, the time of the last arrival handed out to the simulation. A
+	    thread read after that must not arrive before it.
+	*/
+	int64_t stream_horizon = std::numeric_limits<int64_t>::min();
+
+	/**
+	STREAM_LOOKAHEAD:
+	    How many pending arrivals read_stream() reads ahead. It tops the stream up once
+	    half of them have been handed out, so threads may be out of arrival order in the
+	    file, as long as no thread is more than half this many places out of order.
+	*/
+	static constexpr size_t STREAM_LOOKAHEAD = 256;
+
+	/**
+	current_time:
+	    The time of the event currently being processed.
 	*/
-	EventQueue events;
+	uint64_t current_time = 0;
+
+	/**
+	first_event:
+	    Whether no event has been processed yet. The CPU is idle until the first arrival.
+	*/
+	bool first_event = true;
 
 	/**
 	system_stats:
@@ -100,11 +235,6 @@ public:
 	*/
 	SystemStats system_stats;
 
-	/**
-	 Helper vector for keeping track of all threads for post-run statistics computation.
-	 */
-	std::vector<std::shared_ptr<Thread>> all_threads[4];
-
 	/**
 	logger:
 	    A logger object that we can use for printing useful information
@@ -119,6 +249,13 @@ public:
 	*/
 	FlagOptions flags;
 
+	/**
+	fast_forward:
+	    Whether uncontended round robin slices are skipped, decided once from the flags. Only
+	    round robin hands a preempted thread straight back when it is alone.
+	*/
+	bool fast_forward = false;
+
 	//==================================================
 	//  Member functions
 	//==================================================
@@ -127,7 +264,7 @@ public:
 	Simulation():
 	    A basic constructor for the simulation.
 	*/
-	Simulation() {}
+	Simulation() : processes(ProcessMap::allocator_type(arena)) {}
 
 	/**
 	Simulation(flags):
@@ -144,6 +281,13 @@ public:
 	*/
 	void run();
 
+	/**
+	process_event(event):
+	    Invokes the handler for the event's type, then logs the resulting state
+	    transition and advances the elapsed time.
+	*/
+	void process_event(Event& event);
+
 	/*
 	handle_*:
 	    These functions are handler functions that are called for each
@@ -158,40 +302,112 @@ public:
 	    Deliverable 1 of this project, and then for Deliverable 2 you will have to implement
 	    them.
 	*/
-	void handle_thread_arrived(const std::shared_ptr<Event> event);
+	void handle_thread_arrived(Event& event);
 
-	void handle_dispatch_completed(const std::shared_ptr<Event> event);
+	void handle_dispatch_completed(Event& event);
 
-	void handle_cpu_burst_completed(const std::shared_ptr<Event> event);
+	void handle_cpu_burst_completed(Event& event);
 
-	void handle_io_burst_completed(const std::shared_ptr<Event> event);
+	void handle_io_burst_completed(Event& event);
 
-	void handle_thread_completed(const std::shared_ptr<Event> event);
+	void handle_thread_completed(Event& event);
 
-	void handle_thread_preempted(const std::shared_ptr<Event> event);
+	void handle_thread_preempted(Event& event);
 
-	void handle_dispatcher_invoked(const std::shared_ptr<Event> event);
+	void handle_dispatcher_invoked(Event& event);
 
 	/**
 	read_file(filename):
-	    This function reads in the simulation file, as specified by filename. If filename is
-	    blank, then it reads in from stdin.
+	    This function reads in the simulation file, as specified by filename. The file is
+	    memory-mapped; a binary workload (see "utilities/binary_workload/binary_workload.hpp")
+	    is recognized by its magic number and used in place, otherwise the text format's
+	    integers are scanned straight out of the mapping. With a cache directory set, a
+	    text file is looked up in the parse cache first, and stored there once parsed.
+	    A filename of "-" or "" reads stdin, which, like a pipe, is read as a stream.
 	*/
 	void read_file(const std::string filename);
 
+	/**
+	read_piped_file():
+	    Reads the simulation file from input_stream, as it arrives. Called by read_file
+	    for stdin and anything else that cannot be memory-mapped.
+	*/
+	void read_piped_file();
+
+	/**
+	read_text(input):
+	    Reads the processes and threads of a text simulation file from input.
+	*/
+	void read_text(IntScanner& input);
+
+	/**
+	read_binary_workload(workload):
+	    Loads the processes and threads of a binary workload. The thread table reads the
+	    bursts from the mapping instead of copying them.
+	*/
+	void read_binary_workload(const BinaryWorkload& workload);
+
+	/**
+	read_process_header(input, num_threads):
+	    Reads the ID, priority and number of threads of a process from the simulation
+	    file, stores the number of threads in num_threads and returns the new, still
+	    empty process. Throws if the priority is not one of the four process types.
+	*/
+	Process* read_process_header(IntScanner& input, int& num_threads);
+
 	/**
 	read_process(input):
 	    Reads in a process from the simulation file. Called by read_file
 	    for each process that is provided in the simulation file.
 	*/
-	std::shared_ptr<Process> read_process(std::istream& input);
+	Process* read_process(IntScanner& input);
 
 	/**
-	read_thread(input, thread_id, process_id, priority):
-	    Reads in a thread from the simulation file. Called by read_process
-	    for each thread in a process, as provided by the simulation file.
+	read_thread(input, process, threads_left):
+	    Reads in a thread of the process from the simulation file and adds it to the
+	    process. Called by read_process until the process has all of its threads. A
+	    thread template adds up to threads_left copies of the thread at once, which
+	    share their bursts and arrive as a run (see ArrivalStream::add_run). Returns
+	    the handle of the (first) thread.
 	*/
-	std::shared_ptr<Thread> read_thread(std::istream& input, int thread_id, int process_id, ProcessPriority priority);
+	ThreadHandle read_thread(IntScanner& input, Process* process, int threads_left);
+
+	/**
+	begin_streaming():
+	    With the -l, --stream flag, reads the header of the simulation file from
+	    stream_input and the first threads after it.
+	*/
+	void begin_streaming();
+
+	/**
+	read_stream():
+	    With the -l, --stream flag, reads threads from the simulation file until the
+	    arrival stream holds STREAM_LOOKAHEAD of them again. Called by read_file, and by
+	    next_event() once half of them have been handed out, so only the threads that arrive
+	    next are read ahead, and only the bursts of threads that have not exited yet stay
+	    in memory. Throws if a thread turns out to arrive before stream_horizon.
+	*/
+	void read_stream();
+
+	/**
+	check_preemption(thread, time):
+	    Called when the thread has just become READY at the given time. If the active thread
+	    is in the middle of a CPU burst and the scheduler wants to preempt it for the new
+	    thread, cuts the burst short: the rest of it is put back, its service time is taken
+	    back, its end is cancelled, and the thread is preempted and the dispatcher invoked now.
+	*/
+	void check_preemption(ThreadHandle thread, uint64_t time);
+
+	/**
+	fast_forward_slices(event, burst_length):
+	    When fast_forward is set, called when a dispatched round robin thread is about
+	    to be sliced with burst_length left of its CPU burst. If the ready queue is empty, the thread would be preempted and
+	    re-dispatched over and over until the next pending event; this computes how many of
+	    those cycles fit, applies their service, dispatch and idle accounting in one step and
+	    schedules the dispatch that follows the last of them. Returns false if no cycle can be
+	    skipped. The verbose log is not reproduced for the skipped cycles.
+	*/
+	bool fast_forward_slices(Event& event, int64_t burst_length);
 
 	/**
 	calculate_statistics():
@@ -200,12 +416,38 @@ public:
 	*/
 	SystemStats calculate_statistics();
 
+	/**
+	has_pending_events():
+	    Returns true if either the event queue or the arrival stream still has events.
+	*/
+	bool has_pending_events() const;
+
+	/**
+	arrival_is_next():
+	    Returns true if the next event to process comes from the arrival stream
+	    rather than the event queue.
+	*/
+	bool arrival_is_next() const;
+
+	/**
+	next_event_time():
+	    Returns the time of the next event to process. There must be one.
+	*/
+	uint64_t next_event_time() const;
+
+	/**
+	next_event():
+	    Removes and returns the next event to process, from whichever of the
+	    arrival stream and the event queue holds the earlier one.
+	*/
+	Event next_event();
+
 	/**
 	add_event(event):
-	    Checks to see if the event is not a nullptr,
-	    then adds it to the event queue.
+	    Moves the event into the event queue, or parks it in pending_dispatch
+	    when it is a same-time dispatcher invocation that can run inline.
 	*/
-	void add_event(std::shared_ptr<Event> event);
+	void add_event(Event event);
 };
 
 #endif
@@ -0,0 +1,80 @@
+#include "types/arrival_stream/arrival_stream.hpp"
+
+#include <algorithm>
+#include <utility>
+
+bool ArrivalStream::arrives_before(const Event& event_1, const Event& event_2)
+{
+	if (event_1.time == event_2.time) {
+		return event_1.event_num < event_2.event_num;
+	}
+	return event_1.time < event_2.time;
+}
+
+void ArrivalStream::add(Event event)
+{
+	if (!sealed || arrivals.empty() || !arrives_before(event, arrivals.back())) {
+		arrivals.push_back(std::move(event));
+		return;
+	}
+	arrivals.insert(std::upper_bound(arrivals.begin(), arrivals.end(), event, arrives_before), std::move(event));
+}
+
+bool ArrivalStream::run_after(const Run& run_1, const Run& run_2)
+{
+	if (run_1.time == run_2.time) {
+		return run_1.event_num > run_2.event_num;
+	}
+	return run_1.time > run_2.time;
+}
+
+void ArrivalStream::update_run_head()
+{
+	if (!runs.empty()) {
+		const Run& run = runs.front();
+		run_head = Event(EventType::THREAD_ARRIVED, run.time, run.event_num, run.thread, NO_SCHEDULING_DECISION);
+	}
+}
+
+void ArrivalStream::add_run(uint64_t time, uint64_t stride, uint64_t event_num, ThreadHandle thread, uint32_t count)
+{
+	if (count == 0) {
+		return;
+	}
+	runs.push_back({ time, stride, event_num, thread, count });
+	std::push_heap(runs.begin(), runs.end(), run_after);
+	run_arrivals += count;
+	update_run_head();
+}
+
+void ArrivalStream::seal()
+{
+	std::sort(arrivals.begin(), arrivals.end(), arrives_before);
+	sealed = true;
+}
+
+Event ArrivalStream::pop()
+{
+	if (run_is_next()) {
+		Event event = run_head;
+		// Only the run's next arrival is kept; it moves on to the one after it.
+		std::pop_heap(runs.begin(), runs.end(), run_after);
+		Run& run = runs.back();
+		if (--run.count == 0) {
+			runs.pop_back();
+		} else {
+			run.time += run.stride;
+			run.event_num++;
+			run.thread++;
+			std::push_heap(runs.begin(), runs.end(), run_after);
+		}
+		run_arrivals--;
+		update_run_head();
+		return event;
+	}
+
+	// Nothing is handed out twice, so the deque frees its blocks as the stream drains.
+	Event event = std::move(arrivals.front());
+	arrivals.pop_front();
+	return event;
+}
@@ -0,0 +1,136 @@
+#ifndef ARRIVAL_STREAM_HPP
+#define ARRIVAL_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "types/event/event.hpp"
+
+/**
+ArrivalStream:
+The THREAD_ARRIVED events of a simulation, kept out of the event queue.
+
+Every thread's arrival is known as soon as the simulation file has been read, so
+instead of pushing all of them into the event queue up front, they are collected
+here, sorted once by (time, event_num) and handed out in order. The simulation
+merges this stream with the event queue when it pops the next event, so the
+queue only ever holds in-flight events.
+
+When the simulation file is streamed (see the -l, --stream flag), arrivals keep
+being added after seal(), a few at a time, as the file is read during the run.
+Each one is put in order among the arrivals that are still pending. Arrivals are
+dropped as they are handed out, so the stream only holds the pending ones.
+
+The copies of a thread template arrive at a fixed stride, so they are added as a
+single run (see add_run) whose events are only made as they are handed out. Runs
+are kept in a small heap on their next arrival and merged with the other arrivals.
+*/
+class ArrivalStream {
+public:
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/**
+	add(event):
+	    Adds a THREAD_ARRIVED event while the simulation file is being read. After
+	    seal(), the event is put in order among the remaining arrivals right away.
+	*/
+	void add(Event event);
+
+	/**
+	add_run(time, stride, event_num, thread, count):
+	    Adds 'count' THREAD_ARRIVED events at once: the n-th arrives at time + n * stride,
+	    with event number event_num + n, for the thread with handle thread + n. The
+	    stride must not be negative.
+	*/
+	void add_run(uint64_t time, uint64_t stride, uint64_t event_num, ThreadHandle thread, uint32_t count);
+
+	/**
+	seal():
+	    Sorts the arrivals once all of them have been added, or, when streaming,
+	    before the first one is.
+	*/
+	void seal();
+
+	/**
+	peek():
+	    Returns the earliest remaining arrival. The stream must not be empty.
+	*/
+	const Event& peek() const { return run_is_next() ? run_head : arrivals.front(); }
+
+	/**
+	pop():
+	    Removes the earliest remaining arrival and returns it.
+	*/
+	Event pop();
+
+	/**
+	empty():
+	    Returns true once every arrival has been handed out.
+	*/
+	bool empty() const { return arrivals.empty() && runs.empty(); }
+
+	/**
+	size():
+	    Returns the number of arrivals still to be handed out.
+	*/
+	size_t size() const { return arrivals.size() + run_arrivals; }
+
+private:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	std::deque<Event> arrivals;
+
+	/**
+	 A run of arrivals, as of its next one.
+	 */
+	struct Run {
+		uint64_t time;
+		uint64_t stride;
+		uint64_t event_num;
+		ThreadHandle thread;
+		uint32_t count;
+	};
+
+	/**
+	 The pending runs, as a heap with the run due next on top, the event of that
+	 run's next arrival, and how many arrivals all the runs have left.
+	 */
+	std::vector<Run> runs;
+	Event run_head = Event(EventType::THREAD_ARRIVED, 0, 0, NO_THREAD, NO_SCHEDULING_DECISION);
+	size_t run_arrivals = 0;
+
+	/**
+	 Whether seal() has been called.
+	 */
+	bool sealed = false;
+
+	/**
+	 Returns true if the next arrival comes from a run.
+	 */
+	bool run_is_next() const { return !runs.empty() && (arrivals.empty() || arrives_before(run_head, arrivals.front())); }
+
+	/**
+	 Rebuilds run_head from the run on top of the heap.
+	 */
+	void update_run_head();
+
+	/**
+	 Orders runs for the heap, with the run due next on top.
+	 */
+	static bool run_after(const Run& run_1, const Run& run_2);
+
+	/**
+	 Returns true if event_1 is due before event_2, in (time, event_num) order.
+	 */
+	static bool arrives_before(const Event& event_1, const Event& event_2);
+};
+
+#endif
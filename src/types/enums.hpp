@@ -1,6 +1,8 @@
 #ifndef ENUMS_HPP
 #define ENUMS_HPP
 
+#include <cstdint>
+
 /*
 A set of enumerated types for various things. These are useful
 because they give us nice names for things like the algorithms
@@ -30,14 +32,26 @@ enum EventType {
 	DISPATCHER_INVOKED
 };
 
-enum ProcessPriority {
+enum ProcessPriority : uint8_t {
 	SYSTEM,
 	INTERACTIVE,
 	NORMAL,
 	BATCH
 };
 
-enum ThreadState {
+enum DecisionReason : uint8_t {
+	NO_DECISION,
+	READY_QUEUE_EMPTY,
+	RUN_TO_COMPLETION,
+	RUN_FOR_TIME_SLICE,
+	RUN_SHORTEST_BURST,
+	RUN_SHORTEST_REMAINING,
+	RUN_HIGHEST_PRIORITY,
+	RUN_FOR_LEVEL_SLICE,
+	RUN_LEAST_VRUNTIME
+};
+
+enum ThreadState : uint8_t {
 	NEW,
 	READY,
 	RUNNING,
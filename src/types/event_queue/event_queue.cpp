@@ -0,0 +1,28 @@
+#include "types/event_queue/event_queue.hpp"
+
+#include <utility>
+
+void EventQueue::push(Event event)
+{
+	uint32_t slot;
+	if (free_slots.empty()) {
+		slot = (uint32_t)slab.size();
+		slab.push_back(std::move(event));
+	} else {
+		slot = free_slots.back();
+		free_slots.pop_back();
+		slab[slot] = std::move(event);
+	}
+
+	insert_key(EventKey{slab[slot].time, slab[slot].event_num, slot});
+}
+
+Event EventQueue::pop()
+{
+	uint32_t slot = top_key().slot;
+	remove_top_key();
+
+	Event event = std::move(slab[slot]);
+	free_slots.push_back(slot);
+	return event;
+}
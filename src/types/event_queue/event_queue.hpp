@@ -0,0 +1,133 @@
+#ifndef EVENT_QUEUE_HPP
+#define EVENT_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "types/event/event.hpp"
+
+/**
+EventKey:
+A compact ordering key for an event stored in an EventQueue. The queue backends
+only ever move these around; the events themselves stay put in the queue's slab.
+*/
+struct EventKey {
+	uint64_t time;
+	uint64_t event_num;
+	uint32_t slot;
+};
+
+struct EventComparator {
+	/**
+	A comparator for the event queue to correctly order the events.
+
+	Fundamentally, we want to order the events based on their time. But what
+	happens when we have multiple events with the same time? A heap is not
+	"stable", that is to say, it does not preserve the order in which you insert elements
+	into the queue. So we need to do some additional checks before simple returning a comparison
+	of event times.
+
+	We ideally we would compare against time, but if the two times are equal, then we look at the
+	events' number.
+
+	Returns true if key_1 should be popped before key_2.
+	*/
+	bool operator()(const EventKey& key_1, const EventKey& key_2) const {
+		if (key_1.time == key_2.time) {
+			return key_1.event_num < key_2.event_num;
+		}
+		return key_1.time < key_2.time;
+	}
+};
+
+/*
+    EventQueue:
+        Base class for the event queue backends.
+
+        Every backend is a min-queue of events ordered by (time, event_num). Events are
+        stored by value in a slab owned by this class, whose freed slots are recycled
+        through a free list, so pushing an event never allocates once the slab has grown
+        to the peak number of pending events. The derived classes only decide how the
+        EventKeys referring to those slots are ordered.
+*/
+class EventQueue {
+public:
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/**
+	push(event):
+	    Moves the event into the slab and inserts its key into the queue.
+	*/
+	void push(Event event);
+
+	/**
+	top():
+	    Returns the earliest pending event. The queue must not be empty.
+	*/
+	const Event& top() const { return slab[top_key().slot]; }
+
+	/**
+	pop():
+	    Removes the earliest pending event from the queue and returns it.
+	    The queue must not be empty.
+	*/
+	Event pop();
+
+	/**
+	empty():
+	    Returns true if there are no pending events.
+	*/
+	bool empty() const { return size() == 0; }
+
+	/**
+	size():
+	    Returns the number of pending events.
+	*/
+	virtual size_t size() const = 0;
+
+	virtual ~EventQueue() {}
+
+protected:
+
+	/**
+	insert_key(key):
+	    Inserts the key of a newly stored event.
+	*/
+	virtual void insert_key(const EventKey& key) = 0;
+
+	/**
+	top_key():
+	    Returns the key of the earliest pending event.
+	*/
+	virtual const EventKey& top_key() const = 0;
+
+	/**
+	remove_top_key():
+	    Removes the key returned by top_key().
+	*/
+	virtual void remove_top_key() = 0;
+
+	EventComparator before;
+
+private:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	/**
+	 Storage for pending (and recycled) events, indexed by EventKey::slot.
+	 */
+	std::vector<Event> slab;
+
+	/**
+	 Slots in the slab that are free to be reused.
+	 */
+	std::vector<uint32_t> free_slots;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "types/event_queue/heap/heap_event_queue.hpp"
+
+void HeapEventQueue::insert_key(const EventKey& key)
+{
+	heap.push_back(key);
+	sift_up(heap.size() - 1);
+}
+
+void HeapEventQueue::remove_top_key()
+{
+	heap.front() = heap.back();
+	heap.pop_back();
+	if (!heap.empty()) {
+		sift_down(0);
+	}
+}
+
+void HeapEventQueue::sift_up(size_t index)
+{
+	EventKey key = heap[index];
+	while (index > 0) {
+		size_t parent = (index - 1) / ARITY;
+		if (!before(key, heap[parent])) {
+			break;
+		}
+		heap[index] = heap[parent];
+		index = parent;
+	}
+	heap[index] = key;
+}
+
+void HeapEventQueue::sift_down(size_t index)
+{
+	EventKey key = heap[index];
+	size_t count = heap.size();
+	while (true) {
+		size_t first_child = index * ARITY + 1;
+		if (first_child >= count) {
+			break;
+		}
+		size_t last_child = (first_child + ARITY < count) ? first_child + ARITY : count;
+		size_t best = first_child;
+		for (size_t child = first_child + 1; child < last_child; ++child) {
+			if (before(heap[child], heap[best])) {
+				best = child;
+			}
+		}
+		if (!before(heap[best], key)) {
+			break;
+		}
+		heap[index] = heap[best];
+		index = best;
+	}
+	heap[index] = key;
+}
@@ -0,0 +1,59 @@
+#ifndef HEAP_EVENT_QUEUE_HPP
+#define HEAP_EVENT_QUEUE_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "types/event_queue/event_queue.hpp"
+
+/*
+    HeapEventQueue:
+        The default event queue backend. Keys are kept in a 4-ary heap, which is half
+        as deep as a binary one.
+
+        This is a derived class from the base event queue class.
+*/
+class HeapEventQueue : public EventQueue {
+public:
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	size_t size() const { return heap.size(); }
+
+protected:
+
+	void insert_key(const EventKey& key);
+
+	const EventKey& top_key() const { return heap.front(); }
+
+	void remove_top_key();
+
+private:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	/**
+	 Arity of the heap. Four children per node halves the depth of a binary heap, so
+	 a push compares and moves half as many keys, for two more comparisons per level
+	 on a pop. Eight would save only a third of the levels again at four more
+	 comparisons per level. In a pop-then-push benchmark at 16 to 200k pending events,
+	 4 was the fastest of 2, 4 and 8, or tied with 8. A 24-byte EventKey means the four
+	 children span two cache lines, so this is about comparisons, not cache lines.
+	 */
+	static constexpr size_t ARITY = 4;
+
+	/**
+	 The d-ary heap of keys, with the earliest event at index 0.
+	 */
+	std::vector<EventKey> heap;
+
+	void sift_up(size_t index);
+
+	void sift_down(size_t index);
+};
+
+#endif
@@ -0,0 +1,165 @@
+#include "types/event_queue/radix/radix_event_queue.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+size_t RadixEventQueue::bucket_index(uint64_t time) const
+{
+	if (time == last) {
+		return 0;
+	}
+	return sizeof(uint64_t) * 8 - __builtin_clzll(time ^ last);
+}
+
+void RadixEventQueue::insert_key(const EventKey& key)
+{
+	if (key.time < last) {
+		throw std::logic_error("RadixEventQueue: event scheduled before the current time");
+	}
+	if (!in_buckets) {
+		if (small.size() < SMALL_QUEUE) {
+			// Events are mostly scheduled after the pending ones, so this rarely moves far.
+			small.push_back(key);
+			for (size_t i = small.size() - 1; i > 0 && before(small[i - 1], small[i]); --i) {
+				std::swap(small[i], small[i - 1]);
+			}
+			count++;
+			return;
+		}
+		move_to_buckets();
+	}
+	insert_bucketed(key);
+	count++;
+}
+
+void RadixEventQueue::insert_bucketed(const EventKey& key)
+{
+	size_t index = bucket_index(key.time);
+	std::vector<EventKey>& bucket = buckets[index];
+	bucket.push_back(key);
+	if (index == 0) {
+		// Keys normally arrive in event_num order; keep bucket 0 sorted if one does not.
+		for (size_t i = bucket.size() - 1; i > head && before(bucket[i], bucket[i - 1]); --i) {
+			std::swap(bucket[i], bucket[i - 1]);
+		}
+	} else {
+		nonempty |= 1ull << (index - 1);
+		if (top_bucket != NO_BUCKET && before(key, buckets[top_bucket][top_index])) {
+			top_bucket = index;
+			top_index = bucket.size() - 1;
+		}
+	}
+}
+
+const EventKey& RadixEventQueue::top_key() const
+{
+	if (!in_buckets) {
+		return small.back();
+	}
+	if (head < buckets[0].size()) {
+		return buckets[0][head];
+	}
+	if (top_bucket == NO_BUCKET) {
+		find_top();
+	}
+	return buckets[top_bucket][top_index];
+}
+
+void RadixEventQueue::remove_top_key()
+{
+	if (!in_buckets) {
+		last = small.back().time;
+		small.pop_back();
+		count--;
+		return;
+	}
+	if (head < buckets[0].size()) {
+		head++;
+		count--;
+		if (count <= SMALL_QUEUE / 2) {
+			move_to_small();
+		}
+		return;
+	}
+
+	// Split the bucket holding the minimum around its time, which becomes the new base. The
+	// minimum itself is what is being removed, so it is left out.
+	if (top_bucket == NO_BUCKET) {
+		find_top();
+	}
+	std::vector<EventKey>& bucket = buckets[top_bucket];
+	std::vector<EventKey>& equal = buckets[0];
+	equal.clear();
+	head = 0;
+	last = bucket[top_index].time;
+	nonempty &= ~(1ull << (top_bucket - 1));
+	for (size_t i = 0; i < bucket.size(); ++i) {
+		if (i == top_index) {
+			continue;
+		}
+		const EventKey& key = bucket[i];
+		size_t index = bucket_index(key.time);
+		buckets[index].push_back(key);
+		if (index > 0) {
+			nonempty |= 1ull << (index - 1);
+		}
+	}
+	bucket.clear();
+	top_bucket = NO_BUCKET;
+
+	// Usually there are none or a few other events at the new time; put them in event_num order.
+	if (equal.size() > 16) {
+		std::sort(equal.begin(), equal.end(), before);
+	} else {
+		for (size_t i = 1; i < equal.size(); ++i) {
+			for (size_t j = i; j > 0 && before(equal[j], equal[j - 1]); --j) {
+				std::swap(equal[j], equal[j - 1]);
+			}
+		}
+	}
+	count--;
+	if (count <= SMALL_QUEUE / 2) {
+		move_to_small();
+	}
+}
+
+void RadixEventQueue::find_top() const
+{
+	size_t index = __builtin_ctzll(nonempty) + 1;
+
+	const std::vector<EventKey>& bucket = buckets[index];
+	size_t best = 0;
+	for (size_t i = 1; i < bucket.size(); ++i) {
+		if (before(bucket[i], bucket[best])) {
+			best = i;
+		}
+	}
+	top_bucket = index;
+	top_index = best;
+}
+
+void RadixEventQueue::move_to_buckets()
+{
+	// Earliest first, so the keys at the last popped time go into bucket 0 in order.
+	for (auto it = small.rbegin(); it != small.rend(); ++it) {
+		insert_bucketed(*it);
+	}
+	small.clear();
+	in_buckets = true;
+}
+
+void RadixEventQueue::move_to_small()
+{
+	small.assign(buckets[0].begin() + head, buckets[0].end());
+	buckets[0].clear();
+	head = 0;
+	while (nonempty != 0) {
+		std::vector<EventKey>& bucket = buckets[__builtin_ctzll(nonempty) + 1];
+		small.insert(small.end(), bucket.begin(), bucket.end());
+		bucket.clear();
+		nonempty &= nonempty - 1;
+	}
+	top_bucket = NO_BUCKET;
+	std::sort(small.begin(), small.end(), [this](const EventKey& a, const EventKey& b) { return before(b, a); });
+	in_buckets = false;
+}
@@ -0,0 +1,127 @@
+#ifndef RADIX_EVENT_QUEUE_HPP
+#define RADIX_EVENT_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "types/event_queue/event_queue.hpp"
+
+/*
+    RadixEventQueue:
+        An event queue backend for monotone integer keys. Simulated time never goes
+        backwards, so every pushed event is at or after the last popped one, which is
+        exactly the case a radix heap is built for.
+
+        Bucket 0 holds the events at the last popped time, in event_num order. Bucket i
+        (i > 0) holds the events whose time differs from the last popped time in bit i-1
+        at the highest. When bucket 0 runs dry, the next pop splits the first non-empty
+        bucket into the lower buckets around its minimum time. Each key moves down at most
+        once per bit of the time type, so push and pop are O(1) amortized regardless of
+        how many events are pending.
+
+        Peeking does not move the base time: the minimum of the first non-empty bucket is
+        found once and cached until the next pop, so a peek followed by a push of an
+        earlier event (e.g. a dispatch while arrivals are pending) stays cheap.
+
+        A radix heap only pays off with many pending events; with a handful, its
+        bookkeeping costs more than a binary heap's. So while at most SMALL_QUEUE events
+        are pending, their keys are kept in a small sorted array instead, and they only
+        move into the buckets once more are pending. They move back once no more than
+        half of that are left, so switching is O(1) amortized as well.
+
+        This is a derived class from the base event queue class.
+*/
+class RadixEventQueue : public EventQueue {
+public:
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	size_t size() const { return count; }
+
+protected:
+
+	void insert_key(const EventKey& key);
+
+	const EventKey& top_key() const;
+
+	void remove_top_key();
+
+private:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	/**
+	 One bucket for "equal to last", plus one per bit of the time type.
+	 */
+	static constexpr size_t NUM_BUCKETS = sizeof(EventKey::time) * 8 + 1;
+
+	std::vector<EventKey> buckets[NUM_BUCKETS];
+
+	/**
+	 The most pending events kept in the small array rather than the buckets.
+	 */
+	static constexpr size_t SMALL_QUEUE = 16;
+
+	/**
+	 The pending keys while there are few of them, latest first, so the minimum is at
+	 the back. Empty while the keys are in the buckets.
+	 */
+	std::vector<EventKey> small;
+
+	/**
+	 Whether the pending keys are in the buckets rather than in the small array.
+	 */
+	bool in_buckets = false;
+
+	/**
+	 Index of the first unpopped key in bucket 0.
+	 */
+	size_t head = 0;
+
+	/**
+	 The time of the most recently popped key, which bucket 0 holds. It only moves on
+	 pop, and no key may be inserted before it.
+	 */
+	uint64_t last = 0;
+
+	/**
+	 Where the minimum key is when bucket 0 is empty: its bucket and its index in that
+	 bucket, or NO_BUCKET if it has not been looked for since the last pop.
+	 */
+	static constexpr size_t NO_BUCKET = NUM_BUCKETS;
+	mutable size_t top_bucket = NO_BUCKET;
+	mutable size_t top_index = 0;
+
+	/**
+	 Bit i-1 is set if bucket i (i > 0) is not empty, so the first non-empty bucket is
+	 found without looking at the empty ones.
+	 */
+	uint64_t nonempty = 0;
+
+	size_t count = 0;
+
+	size_t bucket_index(uint64_t time) const;
+
+	/**
+	 Finds the minimum key of the first non-empty bucket, once bucket 0 is empty.
+	 */
+	void find_top() const;
+
+	/**
+	 Inserts the key into the buckets.
+	 */
+	void insert_bucketed(const EventKey& key);
+
+	/**
+	 Moves the keys of the small array into the buckets, or back.
+	 */
+	void move_to_buckets();
+	void move_to_small();
+};
+
+#endif
@@ -5,7 +5,7 @@
 #include <vector>
 
 #include "types/enums.hpp"
-#include "types/thread/thread.hpp"
+#include "types/thread_table/thread_table.hpp"
 
 /**
 Process:
@@ -34,9 +34,9 @@ public:
 
 	/**
 	threads:
-	    A vector of the process's threads.
+	    The handles of the process's threads, in thread ID order.
 	*/
-	std::vector<std::shared_ptr<Thread>> threads;
+	std::vector<ThreadHandle> threads;
 
 	//==================================================
 	//  Member functions
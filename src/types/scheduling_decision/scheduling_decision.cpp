@@ -0,0 +1,37 @@
+#include "types/scheduling_decision/scheduling_decision.hpp"
+
+#include <string>
+
+#include "utilities/fmt/format.h"
+
+std::string SchedulingDecision::explanation() const {
+	switch (reason) {
+	case NO_DECISION:
+		break;
+
+	case READY_QUEUE_EMPTY:
+		return "No threads left in ready queue to execute.";
+
+	case RUN_TO_COMPLETION:
+		return fmt::format("Selected from {} threads. Will run to completion of burst.", ready_count);
+
+	case RUN_FOR_TIME_SLICE:
+		return fmt::format("Selected from {} threads. Will run for at most {} ticks.", ready_count, time_slice);
+
+	case RUN_SHORTEST_BURST:
+		return fmt::format("Selected from {} threads; it has the shortest next CPU burst. Will run to completion of burst.", ready_count);
+
+	case RUN_SHORTEST_REMAINING:
+		return fmt::format("Selected from {} threads; it has the least CPU burst left. Will run until a shorter one is ready.", ready_count);
+
+	case RUN_HIGHEST_PRIORITY:
+		return fmt::format("Selected from {} threads; it has the highest priority. Will run to completion of burst.", ready_count);
+
+	case RUN_FOR_LEVEL_SLICE:
+		return fmt::format("Selected from {} threads; it is in the highest non-empty level. Will run for at most {} ticks.", ready_count, time_slice);
+
+	case RUN_LEAST_VRUNTIME:
+		return fmt::format("Selected from {} threads; it has the least virtual runtime. Will run for at most {} ticks.", ready_count, time_slice);
+	}
+	return "";
+}
@@ -1,14 +1,20 @@
 #ifndef SCHEDULING_DECISION_HPP
 #define SCHEDULING_DECISION_HPP
 
-#include <memory>
+#include <cstdint>
+#include <string>
 
-#include "types/thread/thread.hpp"
+#include "types/enums.hpp"
+#include "types/thread_table/thread_table.hpp"
 
 /**
 SchedulingDecision:
 A class for a scheduling decision. This is what your
 algorithm should return.
+
+It is a small value: the decision itself plus a reason code and the numbers
+needed to explain it. The human-readable explanation is only rendered, by
+explanation(), when verbose output asks for it.
 */
 class SchedulingDecision {
 public:
@@ -19,24 +25,47 @@ public:
 
 	/**
 	thread:
-	A thread. The next thread to run,
+	The handle of the next thread to run, or NO_THREAD if there is none.
+	*/
+	ThreadHandle thread = NO_THREAD;
+
+	/**
+	reason:
+	Why the thread was chosen (or why none was), as a DecisionReason defined
+	in "types/enums.hpp". NO_DECISION if this holds no decision at all.
 	*/
-	std::shared_ptr<Thread> thread = nullptr;
+	DecisionReason reason = NO_DECISION;
 
 	/**
-	explanation:
-	A string containing an explanation of the scheduling decision. See
-	the Scheduler class for an example of what this should be.
+	ready_count:
+	The number of threads the scheduler had to choose from.
 	*/
-	std::string explanation;
+	uint32_t ready_count = 0;
 
 	/**
 	time_slice:
 	The time slice for preemptive algorithms. -1 if the thread
 	should not be preempted.
 	*/
-	int time_slice = -1;
+	int64_t time_slice = -1;
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/**
+	explanation():
+	Renders a human-readable explanation of the decision, e.g.
+	"Selected from 9 threads. Will run to completion of burst."
+	*/
+	std::string explanation() const;
 
 };
 
+/**
+NO_SCHEDULING_DECISION:
+The decision carried by events that do not need one.
+*/
+constexpr SchedulingDecision NO_SCHEDULING_DECISION{};
+
 #endif
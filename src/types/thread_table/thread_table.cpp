@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include "types/thread_table/thread_table.hpp"
+
+const std::map<ThreadState, std::string> ThreadTable::threadstate_string = {
+	{ ThreadState::NEW, "NEW" },
+	{ ThreadState::READY, "READY" },
+	{ ThreadState::RUNNING, "RUNNING" },
+	{ ThreadState::BLOCKED, "BLOCKED" },
+	{ ThreadState::EXIT, "EXIT" }
+};
+
+// Valid transitions, as a bit set of the states each state may move to.
+static constexpr unsigned state_bit(ThreadState state) { return 1u << state; }
+
+static constexpr unsigned VALID_TRANSITIONS[5] = {
+	/* NEW */     state_bit(ThreadState::READY),
+	/* READY */   state_bit(ThreadState::RUNNING),
+	/* RUNNING */ state_bit(ThreadState::READY) | state_bit(ThreadState::BLOCKED) | state_bit(ThreadState::EXIT),
+	/* BLOCKED */ state_bit(ThreadState::READY),
+	/* EXIT */    0
+};
+
+ThreadHandle ThreadTable::add(int64_t arrival, int thread_id, int process_id, ProcessPriority priority) {
+	if (size() >= NO_THREAD) {
+		throw std::length_error("ThreadTable: too many threads for a 32-bit handle");
+	}
+	ThreadHandle thread = (ThreadHandle)size();
+	this->thread_id.push_back(thread_id);
+	this->process_id.push_back(process_id);
+	this->arrival_time.push_back(arrival);
+	this->start_time.push_back(-1);
+	this->end_time.push_back(-1);
+	this->service_time.push_back(0);
+	this->io_time.push_back(0);
+	this->state_change_time.push_back(-1);
+	this->priority.push_back(priority);
+	this->current_state.push_back(ThreadState::NEW);
+	this->previous_state.push_back(ThreadState::NEW);
+	this->burst_segment.push_back(0);
+	this->burst_offset.push_back(0);
+	this->burst_count.push_back(0);
+	this->burst_cursor.push_back(0);
+	this->burst_remaining.push_back(0);
+	return thread;
+}
+
+void ThreadTable::reserve(size_t count) {
+	thread_id.reserve(count);
+	process_id.reserve(count);
+	arrival_time.reserve(count);
+	start_time.reserve(count);
+	end_time.reserve(count);
+	service_time.reserve(count);
+	io_time.reserve(count);
+	state_change_time.reserve(count);
+	priority.reserve(count);
+	current_state.reserve(count);
+	previous_state.reserve(count);
+	burst_segment.reserve(count);
+	burst_offset.reserve(count);
+	burst_count.reserve(count);
+	burst_cursor.reserve(count);
+	burst_remaining.reserve(count);
+}
+
+void ThreadTable::add_burst(ThreadHandle thread, int64_t length) {
+	add_bursts(thread, &length, 1);
+}
+
+void ThreadTable::add_bursts(ThreadHandle thread, const int64_t* lengths, uint32_t count) {
+	if (attached_bursts != nullptr || (size_t)thread + 1 != size()) {
+		throw std::logic_error("ThreadTable: bursts must be added right after their thread");
+	}
+	if (count == 0) {
+		return;
+	}
+	if (burst_segments.empty() || burst_segments.back().capacity - burst_segments.back().used < count) {
+		start_burst_segment(thread, count);
+	}
+	BurstSegment& segment = burst_segments.back();
+	if (burst_count[thread] == 0) {
+		burst_segment[thread] = (uint32_t)(burst_segments.size() - 1);
+		burst_offset[thread] = segment.used;
+		burst_remaining[thread] = lengths[0];
+		segment.live++;
+	}
+	std::copy(lengths, lengths + count, segment.lengths.get() + segment.used);
+	segment.used += count;
+	burst_count[thread] += count;
+}
+
+void ThreadTable::share_bursts(ThreadHandle thread, ThreadHandle from) {
+	if (attached_bursts != nullptr || (size_t)thread + 1 != size() || burst_count[thread] != 0 || burst_count[from] == 0) {
+		throw std::logic_error("ThreadTable: bursts can only be shared with a new thread, from a thread that has them");
+	}
+	burst_segment[thread] = burst_segment[from];
+	burst_offset[thread] = burst_offset[from];
+	burst_count[thread] = burst_count[from];
+	burst_remaining[thread] = bursts(from)[0];
+	burst_segments[burst_segment[from]].live++;
+}
+
+static size_t hash_bursts(const int64_t* lengths, uint32_t count) {
+	uint64_t hash = count * 0x9e3779b97f4a7c15ull;
+	for (uint32_t i = 0; i < count; ++i) {
+		hash = (hash ^ (uint64_t)lengths[i]) * 0xff51afd7ed558ccdull;
+		hash ^= hash >> 32;
+	}
+	return (size_t)hash;
+}
+
+void ThreadTable::intern_bursts(ThreadHandle thread) {
+	uint32_t count = burst_count[thread];
+	if (attached_bursts != nullptr || count == 0 || (size_t)thread + 1 != size()) {
+		return;
+	}
+	if (interned.empty()) {
+		interned.assign(INTERN_TABLE_SIZE, NO_THREAD);
+	}
+
+	const int64_t* lengths = bursts(thread);
+	ThreadHandle& slot = interned[hash_bursts(lengths, count) & (INTERN_TABLE_SIZE - 1)];
+	ThreadHandle match = slot;
+	// The matching thread's segment may have been freed since, once every thread in it exited.
+	if (match != NO_THREAD && burst_count[match] == count && burst_segments[burst_segment[match]].lengths != nullptr &&
+		std::equal(lengths, lengths + count, bursts(match))) {
+		// The thread's own copy is at the end of the last segment, so it can be taken back.
+		BurstSegment& segment = burst_segments[burst_segment[thread]];
+		segment.used -= count;
+		segment.live--;
+		burst_count[thread] = 0;
+		share_bursts(thread, match);
+		return;
+	}
+	slot = thread;
+}
+
+void ThreadTable::start_burst_segment(ThreadHandle thread, uint32_t extra) {
+	uint32_t count = burst_count[thread];
+	BurstSegment segment;
+	segment.capacity = std::max(BURST_SEGMENT_SIZE, (count + extra) * 2);
+	segment.lengths.reset(new int64_t[segment.capacity]);
+
+	if (!burst_segments.empty()) {
+		// The thread being added may have started in the full segment; it moves over whole.
+		BurstSegment& previous = burst_segments.back();
+		if (count > 0) {
+			std::copy(bursts(thread), bursts(thread) + count, segment.lengths.get());
+			previous.used -= count;
+			previous.live--;
+			segment.used = count;
+			segment.live = 1;
+		}
+		if (previous.live == 0) {
+			previous.lengths.reset();
+		}
+	}
+
+	burst_segments.push_back(std::move(segment));
+	if (count > 0) {
+		burst_segment[thread] = (uint32_t)(burst_segments.size() - 1);
+		burst_offset[thread] = 0;
+	}
+}
+
+void ThreadTable::release_bursts(ThreadHandle thread) {
+	if (attached_bursts != nullptr || burst_count[thread] == 0) {
+		return;
+	}
+	uint32_t index = burst_segment[thread];
+	BurstSegment& segment = burst_segments[index];
+	// The last segment may still be filled by threads that are yet to be added.
+	if (--segment.live == 0 && index + 1 != burst_segments.size()) {
+		segment.lengths.reset();
+	}
+}
+
+void ThreadTable::attach_bursts(const int64_t* lengths, size_t count) {
+	if (!burst_segments.empty()) {
+		throw std::logic_error("ThreadTable: cannot attach bursts once bursts have been added");
+	}
+	attached_bursts = lengths;
+	attached_burst_count = count;
+}
+
+void ThreadTable::set_bursts(ThreadHandle thread, size_t first, uint32_t count) {
+	if (attached_bursts == nullptr || first > attached_burst_count || count > attached_burst_count - first) {
+		throw std::logic_error("ThreadTable: bursts out of range of the attached bursts");
+	}
+	burst_offset[thread] = first;
+	burst_count[thread] = count;
+	burst_cursor[thread] = 0;
+	burst_remaining[thread] = (count > 0) ? attached_bursts[first] : 0;
+}
+
+void ThreadTable::set_ready(ThreadHandle thread, int64_t time) {
+	set_state(thread, ThreadState::READY, time);
+}
+
+void ThreadTable::set_running(ThreadHandle thread, int64_t time) {
+	set_state(thread, ThreadState::RUNNING, time);
+	if (start_time[thread] == -1) {
+		start_time[thread] = time;
+	}
+}
+
+void ThreadTable::set_blocked(ThreadHandle thread, int64_t time) {
+	set_state(thread, ThreadState::BLOCKED, time);
+}
+
+void ThreadTable::set_finished(ThreadHandle thread, int64_t time) {
+	set_state(thread, ThreadState::EXIT, time);
+	end_time[thread] = time;
+	release_bursts(thread);
+}
+
+void ThreadTable::set_state(ThreadHandle thread, ThreadState state, int64_t time) {
+	if (!is_valid_transition(current_state[thread], state)) {
+		std::ostringstream oss;
+		oss << "Invalid transition from " << ThreadTable::threadstate_string.at(current_state[thread])
+			<< " to " << ThreadTable::threadstate_string.at(state);
+		throw(oss.str());
+	}
+	previous_state[thread] = current_state[thread];
+	current_state[thread] = state;
+	state_change_time[thread] = time;
+}
+
+bool ThreadTable::is_valid_transition(ThreadState from, ThreadState to) {
+	return VALID_TRANSITIONS[from] & state_bit(to);
+}
+
+int64_t ThreadTable::get_next_burst(ThreadHandle thread, BurstType type) const {
+	if (!has_next_burst(thread)) {
+		throw("No next burst for thread");
+	}
+	// Bursts alternate CPU, IO, CPU, ..., so the type follows from the position.
+	BurstType next_type = (burst_cursor[thread] % 2 == 0) ? BurstType::CPU : BurstType::IO;
+	if (next_type != type) {
+		throw("Invalid next burst type for thread");
+	}
+	return burst_remaining[thread];
+}
+
+int64_t ThreadTable::pop_next_burst(ThreadHandle thread, BurstType type) {
+	int64_t length = get_next_burst(thread, type);
+	uint32_t cursor = ++burst_cursor[thread];
+	if (cursor < burst_count[thread]) {
+		burst_remaining[thread] = bursts(thread)[cursor];
+	}
+	return length;
+}
+
+void ThreadTable::cut_burst(ThreadHandle thread, int64_t remaining) {
+	if (burst_cursor[thread] == 0 || (burst_cursor[thread] - 1) % 2 != 0) {
+		throw std::logic_error("ThreadTable: only a CPU burst that was just popped can be cut short");
+	}
+	burst_cursor[thread]--;
+	burst_remaining[thread] = remaining;
+}
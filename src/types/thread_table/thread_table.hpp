@@ -0,0 +1,368 @@
+#ifndef THREAD_TABLE_HPP
+#define THREAD_TABLE_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <map>
+#include <string>
+
+#include "types/enums.hpp"
+
+/**
+ThreadHandle:
+A thread's row in the ThreadTable. Handles are handed out in the order the
+threads are added, and are what every other part of the simulation passes
+around instead of a pointer to the thread.
+*/
+using ThreadHandle = uint32_t;
+
+/**
+NO_THREAD:
+The handle used where there is no thread, e.g. an idle CPU or an event that
+does not need a thread.
+*/
+constexpr ThreadHandle NO_THREAD = std::numeric_limits<ThreadHandle>::max();
+
+/**
+ThreadTable:
+All the threads of a simulation, stored column by column. Row h of every column
+belongs to the thread with handle h, so a pass over one field (e.g. the turnaround
+times for the statistics) only touches that field's memory. Anything that you may
+need to do on a thread should be done here, given its handle.
+*/
+class ThreadTable {
+public:
+
+	//==================================================
+	//  Member variables
+	//==================================================
+
+	/**
+	thread_id:
+	    The thread's ID. These are only unique within the context of a process.
+	*/
+	std::vector<int> thread_id;
+
+	/**
+	process_id:
+	    The ID for the thread's parent process. Each thread has a parent!
+	*/
+	std::vector<int> process_id;
+
+	/**
+	arrival_time:
+	    When the thread arrived into the simulation. Taken from the input file.
+	*/
+	std::vector<int64_t> arrival_time;
+
+	/**
+	start_time:
+	    The time the CPU was first able to execute the thread. Set when the
+	    thread first transitions from READY to RUNNING, -1 until then.
+	*/
+	std::vector<int64_t> start_time;
+
+	/**
+	end_time:
+	    The time that all of the thread's CPU and IO bursts were completed.
+	    Set when the thread transitions from RUNNING to EXIT, -1 until then.
+	*/
+	std::vector<int64_t> end_time;
+
+	/**
+	service_time:
+	    The total time the thread spent on the CPU.
+	*/
+	std::vector<int64_t> service_time;
+
+	/**
+	io_time:
+	    The total time the thread spent in IO.
+	*/
+	std::vector<int64_t> io_time;
+
+	/**
+	state_change_time:
+	    The time of the thread's last state change.
+	*/
+	std::vector<int64_t> state_change_time;
+
+	/**
+	priority:
+	    The priority of the parent process (and thus the priority of the thread).
+	*/
+	std::vector<ProcessPriority> priority;
+
+	/**
+	current_state:
+	    The current state of the thread. All threads start as NEW.
+	*/
+	std::vector<ThreadState> current_state;
+
+	/**
+	previous_state:
+	    The previous state of the thread. NEW until the thread's first transition.
+	*/
+	std::vector<ThreadState> previous_state;
+
+	/**
+	BurstSegment:
+	    A block of burst lengths owned by the table. Each thread's bursts are contiguous
+	    within one segment, and alternate CPU, IO, CPU, ..., ending with a CPU burst, in
+	    the order specified in the simulation file. Threads may share their bursts (see
+	    share_bursts). A segment is freed once every thread with bursts in it has exited,
+	    so a long simulation only keeps the bursts of threads that can still run.
+	*/
+	struct BurstSegment {
+		std::unique_ptr<int64_t[]> lengths;
+		uint32_t capacity = 0;
+		uint32_t used = 0;
+		uint32_t live = 0;
+	};
+
+	/**
+	BURST_SEGMENT_SIZE:
+	    The number of burst lengths in a segment, unless a single thread needs more.
+	*/
+	static constexpr uint32_t BURST_SEGMENT_SIZE = 1 << 16;
+
+	/**
+	burst_segments:
+	    The bursts of every thread added with add_burst. Unused if the bursts live
+	    elsewhere (see attach_bursts).
+	*/
+	std::vector<BurstSegment> burst_segments;
+
+	/**
+	attached_bursts:
+	    Burst lengths owned by someone else, e.g. a memory-mapped binary workload, or
+	    nullptr if the bursts are in burst_segments.
+	*/
+	const int64_t* attached_bursts = nullptr;
+
+	/**
+	attached_burst_count:
+	    The number of burst lengths at attached_bursts.
+	*/
+	size_t attached_burst_count = 0;
+
+	/**
+	interned:
+	    For intern_bursts, the thread that last stored a burst sequence with each hash
+	    slot, or NO_THREAD. Empty until the first thread is interned.
+	*/
+	std::vector<ThreadHandle> interned;
+
+	/**
+	burst_segment:
+	    The index of the segment holding the thread's bursts. Unused for attached bursts.
+	*/
+	std::vector<uint32_t> burst_segment;
+
+	/**
+	burst_offset:
+	    The index of the thread's first burst, within its segment or the attached bursts.
+	*/
+	std::vector<size_t> burst_offset;
+
+	/**
+	burst_count:
+	    The number of bursts the thread has.
+	*/
+	std::vector<uint32_t> burst_count;
+
+	/**
+	burst_cursor:
+	    The index, relative to burst_offset, of the thread's next burst. The thread
+	    has no bursts left once this reaches burst_count.
+	*/
+	std::vector<uint32_t> burst_cursor;
+
+	/**
+	burst_remaining:
+	    The remaining length of the thread's next burst. This is what a preemption
+	    shortens, so a partially completed CPU burst keeps its progress here.
+	*/
+	std::vector<int64_t> burst_remaining;
+
+	/**
+	 Helper map for converting a ThreadState to a string.
+	 */
+	static const std::map<ThreadState, std::string> threadstate_string;
+
+	//==================================================
+	//  Member functions
+	//==================================================
+
+	/**
+	add(arrival, thread_id, process_id, priority):
+	    Adds a NEW thread with the given arrival time, thread ID, process ID and
+	    priority, and returns its handle.
+	*/
+	ThreadHandle add(int64_t arrival, int thread_id, int process_id, ProcessPriority priority);
+
+	/**
+	add_burst(thread, length):
+	    Appends a burst to the thread's bursts. Bursts must be added right after their
+	    thread, before the next thread is added, so that they stay contiguous.
+	*/
+	void add_burst(ThreadHandle thread, int64_t length);
+
+	/**
+	add_bursts(thread, lengths, count):
+	    Appends 'count' bursts to the thread's bursts at once, like add_burst.
+	*/
+	void add_bursts(ThreadHandle thread, const int64_t* lengths, uint32_t count);
+
+	/**
+	share_bursts(thread, from):
+	    Gives the thread the same bursts as 'from', without copying them, e.g. for the
+	    copies of a thread template. The thread must have been added last and have no
+	    bursts of its own; 'from' must have all of its bursts.
+	*/
+	void share_bursts(ThreadHandle thread, ThreadHandle from);
+
+	/**
+	intern_bursts(thread):
+	    Called once the thread added last has all of its bursts. If a thread added
+	    before it has the same bursts, and they are still in memory, the thread shares
+	    those instead and its own copy is dropped, so that a burst sequence that many
+	    threads have is stored once. Each thread keeps its own burst_cursor and
+	    burst_remaining, so a preempted thread does not affect the others.
+	*/
+	void intern_bursts(ThreadHandle thread);
+
+	/**
+	INTERN_TABLE_SIZE:
+	    How many burst sequences intern_bursts remembers. The table is direct-mapped on
+	    a hash of the sequence, so it stays this small however many threads there are;
+	    a sequence whose slot has been taken over is simply stored again.
+	*/
+	static constexpr size_t INTERN_TABLE_SIZE = 1 << 16;
+
+	/**
+	attach_bursts(lengths, count):
+	    Makes the table read burst lengths from 'lengths', which must outlive it, instead of
+	    storing its own. Threads are then given their bursts with set_bursts.
+	*/
+	void attach_bursts(const int64_t* lengths, size_t count);
+
+	/**
+	set_bursts(thread, first, count):
+	    Gives the thread the 'count' attached bursts starting at index 'first'.
+	*/
+	void set_bursts(ThreadHandle thread, size_t first, uint32_t count);
+
+	/**
+	bursts(thread):
+	    Returns the thread's bursts, burst_count of them. Only valid until the thread
+	    exits, as its segment may be freed then.
+	*/
+	const int64_t* bursts(ThreadHandle thread) const {
+		if (attached_bursts != nullptr) {
+			return attached_bursts + burst_offset[thread];
+		}
+		return burst_segments[burst_segment[thread]].lengths.get() + burst_offset[thread];
+	}
+
+	/**
+	reserve(count):
+	    Reserves room in every column for 'count' threads.
+	*/
+	void reserve(size_t count);
+
+	/**
+	size():
+	    Returns the number of threads in the table.
+	*/
+	size_t size() const { return thread_id.size(); }
+
+	/*
+	set_*:
+	    Sets the thread to the appropriate state at the appropriate time. The time is
+	    used to set the state_change_time value. An invalid transition, e.g. NEW->BLOCKED,
+	    throws an exception.
+	*/
+	void set_ready(ThreadHandle thread, int64_t time);
+
+	void set_running(ThreadHandle thread, int64_t time);
+
+	void set_blocked(ThreadHandle thread, int64_t time);
+
+	void set_finished(ThreadHandle thread, int64_t time);
+
+	void set_state(ThreadHandle thread, ThreadState state, int64_t time);
+
+	/**
+	 Returns whether or not the specified transition is valid.
+	 */
+	static bool is_valid_transition(ThreadState from, ThreadState to);
+
+	/**
+	response_time(thread):
+	    Calculate the response time for this particular thread.
+	*/
+	int64_t response_time(ThreadHandle thread) const { return start_time[thread] - arrival_time[thread]; }
+
+	/**
+	turnaround_time(thread):
+	    Calculate the turnaround time for this particular thread.
+	*/
+	int64_t turnaround_time(ThreadHandle thread) const { return end_time[thread] - arrival_time[thread]; }
+
+	/**
+	has_next_burst(thread):
+	    Returns true if the thread has bursts left.
+	*/
+	bool has_next_burst(ThreadHandle thread) const { return burst_cursor[thread] < burst_count[thread]; }
+
+	/**
+	get_next_burst(thread, type):
+	    Returns the remaining length of the thread's next burst. The thread must have
+	    one, and it must be of the given type.
+	*/
+	int64_t get_next_burst(ThreadHandle thread, BurstType type) const;
+
+	/**
+	pop_next_burst(thread, type):
+	    Returns the remaining length of the thread's next burst and moves on to the one
+	    after it. The thread must have a next burst, and it must be of the given type.
+	*/
+	int64_t pop_next_burst(ThreadHandle thread, BurstType type);
+
+	/**
+	cut_burst(thread, remaining):
+	    Undoes the pop_next_burst of the CPU burst the thread is running, when the thread
+	    is preempted before finishing it: the burst becomes the thread's next one again,
+	    with 'remaining' of it left.
+	*/
+	void cut_burst(ThreadHandle thread, int64_t remaining);
+
+	/**
+	update_burst_time(thread, delta_t):
+	    Shortens the thread's next burst by delta_t. This is useful when you have a
+	    preemptive algorithm, to keep track of a burst's remaining length after it
+	    has been preempted.
+	*/
+	void update_burst_time(ThreadHandle thread, int64_t delta_t) { burst_remaining[thread] -= delta_t; }
+
+private:
+
+	/**
+	 Starts a new burst segment for the thread being added, with room for 'extra'
+	 more of its bursts, moving the bursts it already has into it.
+	 */
+	void start_burst_segment(ThreadHandle thread, uint32_t extra);
+
+	/**
+	 Drops the exited thread's hold on its segment, freeing the segment if it was
+	 the last one.
+	 */
+	void release_bursts(ThreadHandle thread);
+
+};
+
+#endif
@@ -0,0 +1,42 @@
+#include "utilities/arena/arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    uintptr_t address = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    char* start = reinterpret_cast<char*>(address);
+
+    if (cursor == nullptr || start + size > limit) {
+        // Start a new block, larger than usual if the request would not fit in one.
+        size_t new_size = std::max(block_size, size + alignment);
+        blocks.push_back({ std::unique_ptr<char[]>(new char[new_size]), new_size });
+        cursor = blocks.back().data.get();
+        limit = cursor + new_size;
+
+        address = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        start = reinterpret_cast<char*>(address);
+    }
+
+    allocated += (start - cursor) + size;
+    cursor = start + size;
+    return start;
+}
+
+void Arena::release() {
+    for (auto it = destructors.rbegin(); it != destructors.rend(); ++it) {
+        it->destroy(it->object);
+    }
+    destructors.clear();
+
+    if (blocks.size() > 1) {
+        blocks.erase(blocks.begin() + 1, blocks.end());
+    }
+    if (blocks.empty()) {
+        cursor = limit = nullptr;
+    } else {
+        cursor = blocks.front().data.get();
+        limit = cursor + blocks.front().size;
+    }
+    allocated = 0;
+}
@@ -0,0 +1,130 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+    Arena:
+        A monotonic bump allocator for objects that all live until the end of a run.
+
+        Memory is carved out of large blocks and never handed back one object at a time;
+        release() drops everything at once. Objects created with make() that are not
+        trivially destructible have their destructors run by release(), in reverse order
+        of creation. The first block is kept across releases, so a Simulation that is
+        run again reuses it instead of going back to malloc.
+*/
+
+class Arena {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        Arena(block_size):
+            Creates an empty arena that grabs memory block_size bytes at a time.
+    */
+    explicit Arena(size_t block_size = 64 * 1024) : block_size(block_size) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() { release(); }
+
+    /*
+        allocate(size, alignment):
+            Returns size bytes of uninitialized memory aligned to 'alignment'. The memory
+            stays valid until release().
+    */
+    void* allocate(size_t size, size_t alignment);
+
+    /*
+        make<T>(args...):
+            Constructs a T from args in the arena and returns a pointer to it. The
+            object is owned by the arena and destroyed by release().
+    */
+    template <typename T, typename... Args>
+    T* make(Args&&... args) {
+        T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if (!std::is_trivially_destructible<T>::value) {
+            destructors.push_back({ object, [](void* ptr) { static_cast<T*>(ptr)->~T(); } });
+        }
+        return object;
+    }
+
+    /*
+        release():
+            Destroys every object made in the arena and frees all but the first block.
+            Every pointer handed out before is invalid afterwards.
+    */
+    void release();
+
+    /*
+        bytes_allocated():
+            Returns the number of bytes handed out since the last release(), including
+            alignment padding.
+    */
+    size_t bytes_allocated() const { return allocated; }
+
+private:
+
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    struct Destructor {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    size_t block_size;
+    std::vector<Block> blocks;
+    std::vector<Destructor> destructors;
+    char* cursor = nullptr;
+    char* limit = nullptr;
+    size_t allocated = 0;
+};
+
+/*
+    ArenaAllocator:
+        A standard allocator that takes its memory from an Arena, for containers whose
+        nodes should die with the arena (e.g. the simulation's process map). Deallocation
+        is a no-op; the memory comes back when the arena is released.
+*/
+
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) : arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+private:
+    template <typename U> friend class ArenaAllocator;
+
+    Arena* arena;
+};
+
+#endif
@@ -0,0 +1,162 @@
+#include "utilities/binary_workload/binary_workload.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "utilities/fmt/format.h"
+
+static bool host_is_little_endian() {
+    return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+}
+
+[[noreturn]] static void fail(const std::string& problem) {
+    throw std::runtime_error("Malformed binary workload: " + problem);
+}
+
+bool BinaryWorkload::is_binary_workload(const char* data, size_t size) {
+    return size >= sizeof(BINARY_WORKLOAD_MAGIC) && std::memcmp(data, BINARY_WORKLOAD_MAGIC, sizeof(BINARY_WORKLOAD_MAGIC)) == 0;
+}
+
+BinaryWorkload::BinaryWorkload(const char* data, size_t size) {
+    if (!host_is_little_endian()) {
+        fail("binary workloads are only supported on little-endian hosts");
+    }
+    if (size < sizeof(BinaryWorkloadHeader) || !is_binary_workload(data, size)) {
+        fail("missing header");
+    }
+
+    header = reinterpret_cast<const BinaryWorkloadHeader*>(data);
+    if (header->version != BINARY_WORKLOAD_VERSION) {
+        fail(fmt::format("unsupported version {} (expected {})", header->version, BINARY_WORKLOAD_VERSION));
+    }
+    if (header->header_size != sizeof(BinaryWorkloadHeader)) {
+        fail(fmt::format("unexpected header size {}", header->header_size));
+    }
+
+    // Check the section sizes without overflowing, then that they add up to the file size.
+    const uint64_t limit = size;
+    if (header->num_processes > limit / sizeof(BinaryProcessRecord) ||
+        header->num_threads > limit / sizeof(BinaryThreadRecord) ||
+        header->num_bursts > limit / sizeof(int64_t)) {
+        fail("section sizes exceed the file size");
+    }
+    uint64_t process_offset = sizeof(BinaryWorkloadHeader);
+    uint64_t thread_offset = process_offset + header->num_processes * sizeof(BinaryProcessRecord);
+    uint64_t burst_offset = thread_offset + header->num_threads * sizeof(BinaryThreadRecord);
+    uint64_t end_offset = burst_offset + header->num_bursts * sizeof(int64_t);
+    if (end_offset != limit) {
+        fail(fmt::format("expected {} bytes, found {}", end_offset, limit));
+    }
+    if (header->num_threads >= NO_THREAD) {
+        fail("too many threads");
+    }
+
+    processes = reinterpret_cast<const BinaryProcessRecord*>(data + process_offset);
+    threads = reinterpret_cast<const BinaryThreadRecord*>(data + thread_offset);
+    bursts = reinterpret_cast<const int64_t*>(data + burst_offset);
+
+    for (uint64_t i = 0; i < header->num_processes; ++i) {
+        const BinaryProcessRecord& process = processes[i];
+        if ((uint64_t)process.first_thread + process.num_threads > header->num_threads) {
+            fail(fmt::format("process {} refers to threads past the thread table", process.process_id));
+        }
+        if (process.priority < SYSTEM || process.priority > BATCH) {
+            fail(fmt::format("process {} has an invalid priority", process.process_id));
+        }
+    }
+    for (uint64_t i = 0; i < header->num_threads; ++i) {
+        const BinaryThreadRecord& thread = threads[i];
+        if (thread.first_burst > header->num_bursts || thread.num_bursts > header->num_bursts - thread.first_burst) {
+            fail(fmt::format("thread {} of process {} refers to bursts past the burst array", thread.thread_id, thread.process_id));
+        }
+        if (thread.num_bursts % 2 == 0) {
+            fail(fmt::format("thread {} of process {} has an invalid number of bursts", thread.thread_id, thread.process_id));
+        }
+        if (thread.priority < SYSTEM || thread.priority > BATCH) {
+            fail(fmt::format("thread {} of process {} has an invalid priority", thread.thread_id, thread.process_id));
+        }
+    }
+}
+
+void BinaryWorkload::write(const std::string& path, int64_t thread_switch_overhead, int64_t process_switch_overhead,
+                           const ThreadTable& threads, const std::vector<const Process*>& processes) {
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        throw std::runtime_error("Unable to open binary workload for writing: " + path);
+    }
+    write(output, thread_switch_overhead, process_switch_overhead, threads, processes);
+    if (!output.flush()) {
+        throw std::runtime_error("Unable to write binary workload: " + path);
+    }
+}
+
+void BinaryWorkload::write(std::ostream& output, int64_t thread_switch_overhead, int64_t process_switch_overhead,
+                           const ThreadTable& threads, const std::vector<const Process*>& processes) {
+    if (!host_is_little_endian()) {
+        throw std::runtime_error("Binary workloads can only be written on little-endian hosts");
+    }
+
+    BinaryWorkloadHeader header = {};
+    std::memcpy(header.magic, BINARY_WORKLOAD_MAGIC, sizeof(header.magic));
+    header.version = BINARY_WORKLOAD_VERSION;
+    header.header_size = sizeof(BinaryWorkloadHeader);
+    header.thread_switch_overhead = thread_switch_overhead;
+    header.process_switch_overhead = process_switch_overhead;
+    header.num_processes = processes.size();
+    header.num_threads = threads.size();
+
+    std::vector<BinaryProcessRecord> process_records;
+    process_records.reserve(processes.size());
+    for (const Process* process : processes) {
+        BinaryProcessRecord record = {};
+        record.process_id = process->process_id;
+        record.priority = process->priority;
+        record.first_thread = process->threads.empty() ? 0 : process->threads.front();
+        record.num_threads = (uint32_t)process->threads.size();
+        for (size_t i = 0; i < process->threads.size(); ++i) {
+            if (process->threads[i] != record.first_thread + i) {
+                throw std::logic_error("BinaryWorkload: a process's threads must have consecutive handles");
+            }
+        }
+        process_records.push_back(record);
+    }
+
+    // Bursts are written in thread order, whatever order they are stored in. Threads
+    // that share their bursts with a thread before them (e.g. the copies of a thread
+    // template, or interned bursts) refer to the same range instead of writing them again.
+    std::vector<BinaryThreadRecord> thread_records;
+    thread_records.reserve(threads.size());
+    std::vector<ThreadHandle> written;
+    std::unordered_map<const int64_t*, uint64_t> written_at;
+    uint64_t num_bursts = 0;
+    for (ThreadHandle thread = 0; thread < threads.size(); ++thread) {
+        BinaryThreadRecord record = {};
+        record.arrival_time = threads.arrival_time[thread];
+        record.num_bursts = threads.burst_count[thread];
+        record.thread_id = threads.thread_id[thread];
+        record.process_id = threads.process_id[thread];
+        record.priority = threads.priority[thread];
+        auto shared = (record.num_bursts > 0) ? written_at.find(threads.bursts(thread)) : written_at.end();
+        if (shared != written_at.end()) {
+            record.first_burst = shared->second;
+        } else {
+            record.first_burst = num_bursts;
+            num_bursts += record.num_bursts;
+            if (record.num_bursts > 0) {
+                written_at[threads.bursts(thread)] = record.first_burst;
+            }
+            written.push_back(thread);
+        }
+        thread_records.push_back(record);
+    }
+    header.num_bursts = num_bursts;
+
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(process_records.data()), process_records.size() * sizeof(BinaryProcessRecord));
+    output.write(reinterpret_cast<const char*>(thread_records.data()), thread_records.size() * sizeof(BinaryThreadRecord));
+    for (ThreadHandle thread : written) {
+        output.write(reinterpret_cast<const char*>(threads.bursts(thread)), threads.burst_count[thread] * sizeof(int64_t));
+    }
+}
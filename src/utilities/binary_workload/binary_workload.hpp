@@ -0,0 +1,118 @@
+#ifndef BINARY_WORKLOAD_HPP
+#define BINARY_WORKLOAD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "types/process/process.hpp"
+#include "types/thread_table/thread_table.hpp"
+
+/*
+    Binary workload format:
+        A simulation file that has already been parsed, laid out so that it can be used
+        straight from a memory mapping. All fields are little-endian, and every section
+        starts at a multiple of 8 bytes from the start of the file:
+
+            BinaryWorkloadHeader
+            BinaryProcessRecord[num_processes]
+            BinaryThreadRecord[num_threads]      in the simulation file's thread order
+            int64_t bursts[num_bursts]           each thread's bursts back to back,
+                                                 alternating CPU and IO lengths
+
+        Files are written by cpu-sim-convert and recognized by read_file from their magic
+        number. A reader must reject any version it does not know.
+*/
+
+constexpr char BINARY_WORKLOAD_MAGIC[8] = { 'C', 'P', 'U', 'S', 'I', 'M', 'W', 'L' };
+
+constexpr uint32_t BINARY_WORKLOAD_VERSION = 1;
+
+struct BinaryWorkloadHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    int64_t thread_switch_overhead;
+    int64_t process_switch_overhead;
+    uint64_t num_processes;
+    uint64_t num_threads;
+    uint64_t num_bursts;
+    uint64_t reserved;
+};
+
+struct BinaryProcessRecord {
+    int32_t process_id;
+    int32_t priority;
+    uint32_t first_thread;  // index of the process's first thread in the thread records
+    uint32_t num_threads;
+};
+
+struct BinaryThreadRecord {
+    int64_t arrival_time;
+    uint64_t first_burst;   // index of the thread's first burst in the burst array
+    uint32_t num_bursts;    // odd, starting and ending with a CPU burst
+    int32_t thread_id;
+    int32_t process_id;
+    int32_t priority;
+};
+
+static_assert(sizeof(BinaryWorkloadHeader) == 64, "unexpected BinaryWorkloadHeader layout");
+static_assert(sizeof(BinaryProcessRecord) == 16, "unexpected BinaryProcessRecord layout");
+static_assert(sizeof(BinaryThreadRecord) == 32, "unexpected BinaryThreadRecord layout");
+
+/*
+    BinaryWorkload:
+        A validated view of a binary workload in memory. The bytes must outlive it.
+*/
+
+class BinaryWorkload {
+public:
+
+    //==================================================
+    //  Member variables
+    //==================================================
+
+    const BinaryWorkloadHeader* header = nullptr;
+    const BinaryProcessRecord* processes = nullptr;
+    const BinaryThreadRecord* threads = nullptr;
+    const int64_t* bursts = nullptr;
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        is_binary_workload(data, size):
+            Returns true if the bytes start with the binary workload magic number.
+    */
+    static bool is_binary_workload(const char* data, size_t size);
+
+    /*
+        BinaryWorkload(data, size):
+            Checks the header, the section sizes and every process, thread and burst
+            index against the size of the data, and sets up the section pointers.
+            Throws std::runtime_error if anything is out of place.
+    */
+    BinaryWorkload(const char* data, size_t size);
+
+    /*
+        write(path, thread_switch_overhead, process_switch_overhead, threads, processes):
+            Writes the given workload to path as a binary workload. The thread records are
+            written in handle order, so every process's threads must have consecutive
+            handles, as they do when read from a simulation file. Throws std::runtime_error
+            if the file cannot be written.
+    */
+    static void write(const std::string& path, int64_t thread_switch_overhead, int64_t process_switch_overhead,
+                      const ThreadTable& threads, const std::vector<const Process*>& processes);
+
+    /*
+        write(output, thread_switch_overhead, process_switch_overhead, threads, processes):
+            Like write(path, ...), but appends the binary workload to an open binary stream.
+    */
+    static void write(std::ostream& output, int64_t thread_switch_overhead, int64_t process_switch_overhead,
+                      const ThreadTable& threads, const std::vector<const Process*>& processes);
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef CHECKED_SUM_HPP
+#define CHECKED_SUM_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+/*
+    CheckedSum:
+        An accumulator for the per-priority response and turnaround totals, which sum one
+        time value per thread and can outgrow 64 bits on long, thread-heavy traces at fine
+        time resolutions.
+
+        The total is kept in 128 bits, which holds the sum of 2^64 64-bit values, so adding
+        never overflows and a long trace still gets its statistics. Only the mean is checked,
+        and it throws if it cannot be represented.
+*/
+
+class CheckedSum {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        CheckedSum(what):
+            Creates an empty accumulator. 'what' names the quantity in the overflow message.
+    */
+    explicit CheckedSum(const char* what) : what(what) {}
+
+    /*
+        add(value):
+            Adds value to the total.
+    */
+    void add(int64_t value) { total += value; }
+
+    /*
+        mean(count):
+            Returns total / count, or 0 if count is 0. Throws std::overflow_error if the
+            mean does not fit in 64 bits.
+    */
+    double mean(size_t count) const {
+        if (count == 0) {
+            return 0.0;
+        }
+        if (total >= std::numeric_limits<int64_t>::min() && total <= std::numeric_limits<int64_t>::max()) {
+            return (double)(int64_t)total / (double)count;
+        }
+        long double average = (long double)total / (long double)count;
+        if (!std::isfinite(average) || std::fabs(average) > (long double)std::numeric_limits<int64_t>::max()) {
+            throw std::overflow_error(std::string("Overflow while averaging ") + what);
+        }
+        return (double)average;
+    }
+
+    __int128 value() const { return total; }
+
+private:
+    __int128 total = 0;
+    const char* what;
+};
+
+#endif
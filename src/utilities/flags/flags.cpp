@@ -1,9 +1,15 @@
 #include "utilities/flags/flags.hpp"
 
+#include <unistd.h>
+
 void print_usage() {
     std::cout <<
         "Usage: cpu-sim [options] filename\n"
         "\n"
+        "The simulation file is read from stdin if filename is \"-\", or if it is left\n"
+        "out and stdin is not a terminal. gzip-compressed files are decompressed as they\n"
+        "are read.\n"
+        "\n"
         "Options\n"
         "   -h, --help:\n"
         "       Print this help message and exit.\n"
@@ -24,16 +30,65 @@ void print_usage() {
         "       The scheduling algorithm to use. Valid values are:\n"
         "           FCFS: first-come, first-served (default)\n"
         "           RR: round-robin scheduling\n"
+        "           SPN: shortest process next\n"
+        "           SRTF: shortest remaining time first (preemptive SPN)\n"
         "           PRIORITY: priority scheduling\n"
         "           MLFQ: multilevel feedback queue\n"
-        "           CUSTOM: A custom algorithm\n";
+        "           CFS: completely fair scheduling (-s sets the target latency)\n"
+        "           CUSTOM: A custom algorithm\n"
+        "\n"
+        "   -q, --event_queue <queue>:\n"
+        "       The event queue backend to use. Valid values are:\n"
+        "           HEAP: a 4-ary heap (default)\n"
+        "           RADIX: a radix heap over the monotone event times\n"
+        "\n"
+        "   -i, --inline_dispatch:\n"
+        "       If set, runs same-time dispatcher invocations inline instead of queueing them.\n"
+        "\n"
+        "   -f, --fast_forward:\n"
+        "       If set, skips round-robin slices of a thread that would be re-dispatched\n"
+        "       immediately. Metrics are unchanged; only valid with RR and cannot be\n"
+        "       combined with -v.\n"
+        "\n"
+        "   -p, --preempt:\n"
+        "       If set, PRIORITY preempts a running thread as soon as a thread of a higher\n"
+        "       priority becomes ready.\n"
+        "\n"
+        "   -n, --levels <value>:\n"
+        "       The number of MLFQ levels, from 1 to 32 (default 3). The time slice\n"
+        "       doubles from each level to the next.\n"
+        "\n"
+        "   -b, --boost <value>:\n"
+        "       How often MLFQ moves every thread back to the top level (default 100),\n"
+        "       or -1 to never do so.\n"
+        "\n"
+        "   -c, --cache_dir <directory>:\n"
+        "       If set, caches parsed simulation files in the directory and reuses them\n"
+        "       while the file is unchanged.\n"
+        "\n"
+        "   -l, --stream:\n"
+        "       If set, reads the simulation file as the simulation reaches each thread's\n"
+        "       arrival. The threads must be in order of arrival time; cannot be combined with -c.\n"
+        "\n"
+        "   -j, --parse_jobs <value>:\n"
+        "       The number of threads that may parse a large simulation file. Defaults to one\n"
+        "       per core; 1 parses on the main thread only. At most 32 MB of the file is\n"
+        "       decoded ahead at once, in smaller pieces as threads are added.\n";
 }
 
 
 int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
     flags.per_thread = false;
     flags.verbose = false;
+    flags.inline_dispatch = false;
+    flags.fast_forward = false;
+    flags.stream = false;
+    flags.preempt = false;
+    flags.levels = 3;
+    flags.boost_interval = 100;
 
+    // Whether --levels or --boost was given, which only apply to MLFQ.
+    bool mlfq_options = false;
 
     // Command-line flags accepted by this program.
     static struct option flag_options[] = {
@@ -42,6 +97,15 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
         {"verbose",     no_argument,        0, 'v'},
         {"algorithm",   required_argument,  0, 'a'},
         {"time_slice",  required_argument,  0, 's'},
+        {"event_queue", required_argument,  0, 'q'},
+        {"inline_dispatch", no_argument,    0, 'i'},
+        {"fast_forward", no_argument,       0, 'f'},
+        {"preempt",     no_argument,        0, 'p'},
+        {"levels",      required_argument,  0, 'n'},
+        {"boost",       required_argument,  0, 'b'},
+        {"cache_dir",   required_argument,  0, 'c'},
+        {"stream",      no_argument,        0, 'l'},
+        {"parse_jobs",  required_argument,  0, 'j'},
         {"help",        no_argument,        0, 'h'},
         {0, 0, 0, 0}
     };
@@ -51,7 +115,7 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
 
     // Parse flags entered by the user.
     while (true) {
-        flag_char = getopt_long(argc, argv, "-s:tvhma:", flag_options, &option_index);
+        flag_char = getopt_long(argc, argv, "-s:tvhma:q:ifpn:b:c:lj:", flag_options, &option_index);
 
         // Detect the end of the options.
         if (flag_char == -1) {
@@ -75,17 +139,71 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
                 flags.scheduler = get_scheduler();
                 break;
 
+            case 'i':
+                flags.inline_dispatch = true;
+                break;
+
+            case 'f':
+                flags.fast_forward = true;
+                break;
+
+            case 'p':
+                flags.preempt = true;
+                break;
+
+            case 'n':
+                try {
+                    flags.levels = std::stoi(optarg);
+                    if (flags.levels < 1 || flags.levels > 32) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                mlfq_options = true;
+                break;
+
+            case 'b':
+                try {
+                    flags.boost_interval = std::stoll(optarg);
+                    if (flags.boost_interval <= 0 && flags.boost_interval != -1) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                mlfq_options = true;
+                break;
+
+            case 'c':
+                flags.cache_dir = optarg;
+                break;
+
+            case 'l':
+                flags.stream = true;
+                break;
+
+            case 'j':
+                try {
+                    flags.parse_jobs = std::stoi(optarg);
+                    if (flags.parse_jobs <= 0) { return 1; }
+                } catch (...) {
+                    return 1;
+                }
+                break;
+
+            case 'q':
+                flags.event_queue = get_event_queue();
+                break;
+
             case 'h':
                 return 1;
                 break;
 
             case 's':
                 try {
-                    flags.time_slice  = std::stoi(optarg);
+                    flags.time_slice  = std::stoll(optarg);
                     if (flags.time_slice <= 0) { return 1; }
                 } catch (...) {
                     return 1;
                 }
+                break;
 
             case 1:
                 flags.filename = optarg;
@@ -96,7 +214,8 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
         }
     }
 
-    if (flags.filename == "") {
+    // Without a filename, read from stdin, unless someone would have to type the file in.
+    if (flags.filename == "" && isatty(STDIN_FILENO)) {
         return 1;
     }
 
@@ -108,7 +227,27 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags) {
         return 1;
     }
 
-    if ((flags.scheduler == "FCFS" || flags.scheduler == "PRIORITY") && (flags.time_slice != -1)) {
+    if (flags.event_queue == "ERROR") {
+        return 1;
+    }
+
+    if (flags.fast_forward && (flags.verbose || flags.scheduler != "RR")) {
+        return 1;
+    }
+
+    if (flags.stream && flags.cache_dir != "") {
+        return 1;
+    }
+
+    if (flags.preempt && flags.scheduler != "PRIORITY") {
+        return 1;
+    }
+
+    if (mlfq_options && flags.scheduler != "MLFQ") {
+        return 1;
+    }
+
+    if ((flags.scheduler == "FCFS" || flags.scheduler == "SPN" || flags.scheduler == "SRTF" || flags.scheduler == "PRIORITY") && (flags.time_slice != -1)) {
         return 1;
     }
 
@@ -120,7 +259,7 @@ std::string get_scheduler() {
     std::string input(optarg);
     std::string input_algorithm = input;
     std::transform(input_algorithm.begin(), input_algorithm.end(), input_algorithm.begin(), ::toupper);
-    std::string valid_algorithms[] = {"FCFS", "RR", "PRIORITY", "MLFQ", "CUSTOM"};
+    std::string valid_algorithms[] = {"FCFS", "RR", "SPN", "SRTF", "PRIORITY", "MLFQ", "CFS", "CUSTOM"};
 
     bool valid = std::find(std::begin(valid_algorithms), std::end(valid_algorithms), input_algorithm) != std::end(valid_algorithms);
 
@@ -131,3 +270,14 @@ std::string get_scheduler() {
     }
     return "";
 }
+
+
+std::string get_event_queue() {
+    std::string input_queue(optarg);
+    std::transform(input_queue.begin(), input_queue.end(), input_queue.begin(), ::toupper);
+
+    if (input_queue == "HEAP" || input_queue == "RADIX") {
+        return input_queue;
+    }
+    return "ERROR";
+}
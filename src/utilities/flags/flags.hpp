@@ -2,6 +2,7 @@
 #define FLAGS_HPP
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <fstream>
 #include <getopt.h>
@@ -24,8 +25,8 @@ public:
 
     /*
         filename:
-            The filename that the simulation should read from. If it is empty (""),
-            then the simulation should read from stdin.
+            The filename that the simulation should read from. If it is empty ("")
+            or "-", then the simulation should read from stdin.
     */
     std::string filename = "";
 
@@ -61,7 +62,7 @@ public:
 
             Set with the -s, --time_slice flag.
     */
-    int time_slice = -1;
+    int64_t time_slice = -1;
 
     /*
         scheduler:
@@ -71,6 +72,93 @@ public:
             Set with the -a, --algorithm flag.
     */
     std::string scheduler = "";
+
+    /*
+        event_queue:
+            A string representing the event queue backend that the
+            simulation should use. Either "HEAP" (the default) or "RADIX".
+
+            Set with the -q, --event_queue flag.
+    */
+    std::string event_queue = "HEAP";
+
+    /*
+        inline_dispatch:
+            Whether DISPATCHER_INVOKED events scheduled for the current time should
+            run inline instead of being pushed through the event queue. The output
+            is identical either way.
+
+            Set to true with the -i, --inline_dispatch flag.
+    */
+    bool inline_dispatch = false;
+
+    /*
+        fast_forward:
+            Whether uncontended round robin slices should be skipped analytically.
+            Only the metrics and per-thread output are preserved, so this cannot be
+            combined with verbose output. Only valid with the RR algorithm.
+
+            Set to true with the -f, --fast_forward flag.
+    */
+    bool fast_forward = false;
+
+    /*
+        preempt:
+            Whether the PRIORITY algorithm should preempt a running thread as soon as a
+            thread of a higher priority becomes ready.
+
+            Set to true with the -p, --preempt flag.
+    */
+    bool preempt = false;
+
+    /*
+        levels:
+            The number of levels of the MLFQ algorithm, from 1 to 32.
+
+            Set with the -n, --levels flag.
+    */
+    int levels = 3;
+
+    /*
+        boost_interval:
+            How often the MLFQ algorithm moves every thread back to its top level.
+            -1 if it never does.
+
+            Set with the -b, --boost flag.
+    */
+    int64_t boost_interval = 100;
+
+    /*
+        cache_dir:
+            A directory in which parsed text simulation files are cached as binary
+            workloads, so that later runs on an unchanged file skip the parse. Empty
+            ("") disables the cache.
+
+            Set with the -c, --cache_dir flag.
+    */
+    std::string cache_dir = "";
+
+    /*
+        stream:
+            Whether a text simulation file should be read as the simulation reaches
+            each thread's arrival, instead of all at once before it starts. The file's
+            threads must be in order of arrival time. Cannot be combined with the
+            parse cache, which needs the whole file parsed.
+
+            Set to true with the -l, --stream flag.
+    */
+    bool stream = false;
+
+    /*
+        parse_jobs:
+            How many threads may tokenize a large simulation file. 0 (the default)
+            uses one per core; 1 reads the file on the main thread only. However many
+            there are, at most 32 MB of the file is decoded ahead of the reader; with
+            more threads, it is cut into smaller pieces so that each has work.
+
+            Set with the -j, --parse_jobs flag.
+    */
+    int parse_jobs = 0;
 };
 
 /*
@@ -93,4 +181,10 @@ int parse_flags(int argc, char* const argv[], FlagOptions& flags);
 */
 std::string get_scheduler();
 
+/*
+    get_event_queue();
+        Return a string denoting the type of event queue to use.
+*/
+std::string get_event_queue();
+
 #endif
@@ -0,0 +1,135 @@
+#include "utilities/gzip_reader/gzip_reader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <zlib.h>
+
+GzipReader::GzipReader(std::unique_ptr<StreamReader> compressed)
+    : StreamReader(-1, false), compressed(std::move(compressed)) {
+    inflater = std::thread(&GzipReader::inflate_all, this);
+}
+
+GzipReader::~GzipReader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    slot_free.notify_all();
+    inflater.join();
+}
+
+bool GzipReader::is_gzip(const char* data, size_t size) {
+    return size >= 2 && (unsigned char)data[0] == 0x1f && (unsigned char)data[1] == 0x8b;
+}
+
+bool GzipReader::push_block(std::vector<char> block) {
+    std::unique_lock<std::mutex> lock(mutex);
+    slot_free.wait(lock, [this] { return stopping || blocks.size() < QUEUE_LENGTH; });
+    if (stopping) {
+        return false;
+    }
+    blocks.push_back(std::move(block));
+    lock.unlock();
+    block_ready.notify_one();
+    return true;
+}
+
+void GzipReader::inflate_all() {
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    std::exception_ptr failure;
+
+    // 15 + 16: a window of up to 32 KB, with a gzip header and trailer.
+    if (inflateInit2(&stream, 15 + 16) != Z_OK) {
+        failure = std::make_exception_ptr(std::runtime_error("Unable to start decompressing the simulation file"));
+    } else {
+        try {
+            std::vector<char> input(StreamReader::BUFFER_SIZE);
+            std::vector<char> block(BLOCK_SIZE);
+            size_t block_used = 0;
+            bool input_done = false;
+            bool in_member = true;
+
+            while (true) {
+                if (stream.avail_in == 0 && !input_done) {
+                    size_t count = compressed->read_bytes(input.data(), input.size());
+                    input_done = (count == 0);
+                    stream.next_in = reinterpret_cast<Bytef*>(input.data());
+                    stream.avail_in = (uInt)count;
+                }
+                if (stream.avail_in == 0 && input_done) {
+                    if (in_member) {
+                        throw std::runtime_error("Malformed simulation file: compressed data ends too early");
+                    }
+                    break;
+                }
+                if (!in_member) {
+                    // Another gzip member follows the one that just ended.
+                    inflateReset(&stream);
+                    in_member = true;
+                }
+
+                stream.next_out = reinterpret_cast<Bytef*>(block.data() + block_used);
+                stream.avail_out = (uInt)(block.size() - block_used);
+                int status = inflate(&stream, Z_NO_FLUSH);
+                if (status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR) {
+                    throw std::runtime_error(std::string("Malformed simulation file: ") + (stream.msg ? stream.msg : "corrupt compressed data"));
+                }
+                block_used = block.size() - stream.avail_out;
+                if (status == Z_STREAM_END) {
+                    in_member = false;
+                }
+
+                if (block_used == block.size()) {
+                    if (!push_block(std::move(block))) {
+                        break;
+                    }
+                    block = std::vector<char>(BLOCK_SIZE);
+                    block_used = 0;
+                }
+            }
+
+            if (block_used > 0) {
+                block.resize(block_used);
+                push_block(std::move(block));
+            }
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        inflateEnd(&stream);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+        error = failure;
+    }
+    block_ready.notify_one();
+}
+
+size_t GzipReader::read_some(char* out, size_t capacity) {
+    std::unique_lock<std::mutex> lock(mutex);
+    block_ready.wait(lock, [this] { return !blocks.empty() || finished; });
+    if (blocks.empty()) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return 0;
+    }
+
+    std::vector<char>& front = blocks.front();
+    size_t count = std::min(capacity, front.size() - front_taken);
+    std::memcpy(out, front.data() + front_taken, count);
+    front_taken += count;
+    if (front_taken == front.size()) {
+        blocks.pop_front();
+        front_taken = 0;
+        lock.unlock();
+        slot_free.notify_one();
+    }
+    return count;
+}
@@ -0,0 +1,92 @@
+#ifndef GZIP_READER_HPP
+#define GZIP_READER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utilities/stream_reader/stream_reader.hpp"
+
+/*
+    GzipReader:
+        A StreamReader for gzip-compressed simulation files. It reads the compressed
+        bytes from another StreamReader and inflates them with zlib on a background
+        thread, so that decompressing and parsing overlap. Only a few blocks of
+        inflated data are kept ahead of the parser; the file is never inflated whole.
+
+        Concatenated gzip members, as written by e.g. 'cat a.gz b.gz' or pigz, are
+        read one after another like gunzip does.
+*/
+
+class GzipReader : public StreamReader {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        GzipReader(compressed):
+            Starts inflating everything 'compressed' has not handed out yet.
+    */
+    explicit GzipReader(std::unique_ptr<StreamReader> compressed);
+
+    /*
+        ~GzipReader():
+            Stops the background thread, even if not everything was read.
+    */
+    ~GzipReader() override;
+
+    /*
+        is_gzip(data, size):
+            Returns true if data starts with the gzip magic number.
+    */
+    static bool is_gzip(const char* data, size_t size);
+
+    /*
+        BLOCK_SIZE, QUEUE_LENGTH:
+            The size of an inflated block, and how many of them may wait for the parser.
+    */
+    static constexpr size_t BLOCK_SIZE = 1 << 20;
+    static constexpr size_t QUEUE_LENGTH = 4;
+
+protected:
+
+    /*
+        read_some(out, capacity):
+            Hands out inflated data, waiting for the background thread if needed.
+    */
+    size_t read_some(char* out, size_t capacity) override;
+
+private:
+    std::unique_ptr<StreamReader> compressed;
+
+    /*
+        Inflated blocks waiting to be read, and how much of the front one has been.
+    */
+    std::deque<std::vector<char>> blocks;
+    size_t front_taken = 0;
+
+    std::mutex mutex;
+    std::condition_variable block_ready;
+    std::condition_variable slot_free;
+    bool finished = false;
+    bool stopping = false;
+    std::exception_ptr error;
+
+    std::thread inflater;
+
+    void inflate_all();
+
+    /*
+        Queues an inflated block. Returns false if the reader is being destroyed.
+    */
+    bool push_block(std::vector<char> block);
+};
+
+#endif
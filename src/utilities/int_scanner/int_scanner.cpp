@@ -0,0 +1,149 @@
+#include "utilities/int_scanner/int_scanner.hpp"
+
+#include <stdexcept>
+
+#include "utilities/fmt/format.h"
+#include "utilities/int_scanner/int_scanner_kernels.hpp"
+#include "utilities/parallel_tokenizer/parallel_tokenizer.hpp"
+#include "utilities/stream_reader/stream_reader.hpp"
+
+static TokenizeKernel select_kernel() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return tokenize_avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return tokenize_sse42;
+    }
+    return nullptr;
+}
+
+static const TokenizeKernel kernel = select_kernel();
+
+void IntScanner::skip_whitespace() {
+    while (cursor != limit && is_space(*cursor)) {
+        cursor++;
+    }
+}
+
+void IntScanner::refill(const char* what) {
+    // A chunk whose tokens ran out with bytes left over stopped at a bad token; the
+    // scalar path below reports it.
+    while (source != nullptr && cursor == limit) {
+        if (!source->next(chunk, cursor, limit)) {
+            cursor = limit = input_end;
+            fail("unexpected end of file", what);
+        }
+        tokens = chunk.data();
+        buffered = chunk.size();
+        taken = 0;
+        if (buffered > 0) {
+            return;
+        }
+    }
+
+    while (true) {
+        if (source == nullptr && kernel != nullptr) {
+            tokens = buffer;
+            buffered = kernel(cursor, limit, buffer, BUFFER_SIZE);
+            taken = 0;
+            if (buffered > 0) {
+                return;
+            }
+        }
+        // Windows end at whitespace, so only an exhausted window needs the next one.
+        skip_whitespace();
+        if (cursor != limit || reader == nullptr || !next_window()) {
+            break;
+        }
+    }
+
+    buffer[0] = scan_int(what);
+    tokens = buffer;
+    buffered = 1;
+    taken = 0;
+}
+
+bool IntScanner::next_window() {
+    consumed_before += limit - start;
+    if (!reader->next(start, limit)) {
+        start = cursor = limit;
+        return false;
+    }
+    cursor = start;
+    return true;
+}
+
+int64_t IntScanner::scan_int(const char* what) {
+    skip_whitespace();
+    if (cursor == limit) {
+        fail("unexpected end of file", what);
+    }
+
+    int64_t value;
+    const char* problem;
+    if (!parse_int(cursor, limit, value, problem)) {
+        fail(problem, what);
+    }
+    return value;
+}
+
+bool IntScanner::parse_int(const char*& cursor, const char* end, int64_t& value, const char*& problem) {
+    bool negative = (*cursor == '-');
+    if (negative) {
+        cursor++;
+    }
+
+    const char* digits = cursor;
+    uint64_t magnitude = 0;
+    while (cursor != end && (unsigned char)(*cursor - '0') < 10) {
+        if (__builtin_mul_overflow(magnitude, 10, &magnitude) || __builtin_add_overflow(magnitude, (uint64_t)(*cursor - '0'), &magnitude)) {
+            problem = "integer out of range";
+            return false;
+        }
+        cursor++;
+    }
+
+    if (cursor == digits || (cursor != end && !is_space(*cursor))) {
+        problem = "expected an integer";
+        return false;
+    }
+    if (magnitude > (uint64_t)INT64_MAX + negative) {
+        problem = "integer out of range";
+        return false;
+    }
+    value = negative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+    return true;
+}
+
+const char* IntScanner::tokenize(const char* begin, const char* end, std::vector<int64_t>& out) {
+    const char* cursor = begin;
+    int64_t batch[BUFFER_SIZE];
+    while (true) {
+        if (kernel != nullptr) {
+            size_t count = kernel(cursor, end, batch, BUFFER_SIZE);
+            if (count > 0) {
+                out.insert(out.end(), batch, batch + count);
+                continue;
+            }
+        }
+
+        while (cursor != end && is_space(*cursor)) {
+            cursor++;
+        }
+        if (cursor == end) {
+            return end;
+        }
+        const char* token = cursor;
+        int64_t value;
+        const char* problem;
+        if (!parse_int(cursor, end, value, problem)) {
+            return token;
+        }
+        out.push_back(value);
+    }
+}
+
+void IntScanner::fail(const char* problem, const char* what) const {
+    throw std::runtime_error(fmt::format("Malformed simulation file at byte {}: {} while reading {}", offset(), problem, what));
+}
@@ -0,0 +1,148 @@
+#ifndef INT_SCANNER_HPP
+#define INT_SCANNER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ParallelTokenizer;
+class StreamReader;
+
+/*
+    IntScanner:
+        Reads whitespace-separated decimal integers straight out of a byte range,
+        e.g. a MappedFile. Unlike 'std::istream >>' it does no locale lookups, no
+        virtual calls and no copying, and it throws std::runtime_error on anything
+        that is not an integer instead of silently failing.
+
+        Integers are decoded ahead in batches by a vectorized tokenizer kernel (see
+        int_scanner_kernels.hpp), AVX2 or SSE4.2 as the CPU allows, and handed out
+        from a small buffer. Whatever the kernel cannot handle, and everything on
+        CPUs without either instruction set, goes through the scalar path.
+
+        Given a ParallelTokenizer, the scanner hands out the integers its worker
+        threads decoded instead, chunk by chunk. Where a worker stopped at a bad
+        token, the scalar path takes over, so the error is the same either way.
+        Given a StreamReader, it tokenizes the reader's windows one after another.
+*/
+
+class IntScanner {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        IntScanner(begin, end, source):
+            Creates a scanner over the bytes [begin, end), which must outlive it. If
+            'source' is given, it must be tokenizing those same bytes.
+    */
+    IntScanner(const char* begin, const char* end, ParallelTokenizer* source = nullptr)
+        : start(begin), cursor(begin), limit(source ? begin : end), input_end(end), source(source) {}
+
+    /*
+        IntScanner(reader):
+            Creates a scanner over everything the reader hands out.
+    */
+    explicit IntScanner(StreamReader& reader)
+        : start(nullptr), cursor(nullptr), limit(nullptr), input_end(nullptr), source(nullptr), reader(&reader) {}
+
+    IntScanner(const IntScanner&) = delete;
+    IntScanner& operator=(const IntScanner&) = delete;
+
+    /*
+        next_int(what):
+            Skips whitespace and returns the next integer. 'what' names the value in
+            the error thrown if there is no integer left or the next token is not one.
+    */
+    int64_t next_int(const char* what) {
+        if (taken == buffered) {
+            refill(what);
+        }
+        return tokens[taken++];
+    }
+
+    /*
+        next_ints(max, count, what):
+            Like next_int, but returns up to 'max' (at least one) integers at once,
+            setting count to how many. They stay valid until the next call.
+    */
+    const int64_t* next_ints(size_t max, size_t& count, const char* what) {
+        if (taken == buffered) {
+            refill(what);
+        }
+        count = std::min(max, buffered - taken);
+        const int64_t* result = tokens + taken;
+        taken += count;
+        return result;
+    }
+
+    /*
+        tokenize(begin, end, out):
+            Appends every integer in [begin, end) to out, and returns end, or where it
+            stopped at the first token that is not an integer. Used by the workers of a
+            ParallelTokenizer.
+    */
+    static const char* tokenize(const char* begin, const char* end, std::vector<int64_t>& out);
+
+    /*
+        is_space(c):
+            Returns true for the bytes that separate integers.
+    */
+    static bool is_space(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    /*
+        offset():
+            Returns how many bytes have been tokenized so far. This can run ahead of
+            the integers returned by next_int(), by up to a buffer's worth of them.
+    */
+    size_t offset() const { return consumed_before + (cursor - start); }
+
+private:
+    static constexpr size_t BUFFER_SIZE = 256;
+
+    const char* start;
+    const char* cursor;
+    const char* limit;
+    const char* input_end;
+
+    ParallelTokenizer* source;
+    std::vector<int64_t> chunk;
+
+    StreamReader* reader = nullptr;
+    size_t consumed_before = 0;
+
+    int64_t buffer[BUFFER_SIZE];
+    const int64_t* tokens = buffer;
+    size_t buffered = 0;
+    size_t taken = 0;
+
+    /*
+        Makes at least one integer available at tokens[taken]: the next chunk from the
+        source, the next batch decoded by the kernel, or a single integer scanned with
+        the scalar path if neither can make progress.
+    */
+    void refill(const char* what);
+
+    /*
+        Moves on to the reader's next window. Returns false at the end of the input.
+    */
+    bool next_window();
+
+    int64_t scan_int(const char* what);
+
+    /*
+        Parses one integer at cursor, or returns false and sets problem.
+    */
+    static bool parse_int(const char*& cursor, const char* end, int64_t& value, const char*& problem);
+
+    void skip_whitespace();
+
+    [[noreturn]] void fail(const char* problem, const char* what) const;
+};
+
+#endif
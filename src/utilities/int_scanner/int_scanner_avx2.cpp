@@ -0,0 +1,35 @@
+// Everything in this file is compiled for AVX2; it is only called if the CPU supports it.
+#pragma GCC target("avx2")
+
+#include <immintrin.h>
+
+#include "utilities/int_scanner/int_scanner_kernels.hpp"
+#include "utilities/int_scanner/int_scanner_blocks.hpp"
+
+namespace {
+
+struct Avx2Block {
+    static constexpr size_t WIDTH = 32;
+
+    static inline void classify(const char* bytes, uint64_t& digits, uint64_t& spaces) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+
+        // x is in [lo, lo + n] iff min(x - lo, n) == x - lo, as unsigned bytes.
+        __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+        __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+
+        __m256i c = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+        __m256i is_control_space = _mm256_cmpeq_epi8(_mm256_min_epu8(c, _mm256_set1_epi8('\r' - '\t')), c);
+        __m256i is_space = _mm256_or_si256(is_control_space, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+
+        digits = (uint32_t)_mm256_movemask_epi8(is_digit);
+        spaces = (uint32_t)_mm256_movemask_epi8(is_space);
+    }
+};
+
+}
+
+size_t tokenize_avx2(const char*& cursor, const char* end, int64_t* out, size_t capacity)
+{
+    return tokenize_blocks<Avx2Block>(cursor, end, out, capacity);
+}
@@ -0,0 +1,106 @@
+#ifndef INT_SCANNER_BLOCKS_HPP
+#define INT_SCANNER_BLOCKS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+    The block loop shared by the tokenizer kernels. Only included by the kernels' own
+    translation units, each of which is compiled for a different instruction set; the
+    anonymous namespace keeps each of them with its own copy.
+
+    Block::classify(bytes, digits, spaces) sets bit i of 'digits' and 'spaces' if byte i
+    of the Block::WIDTH bytes at 'bytes' is a digit or whitespace, respectively.
+*/
+
+namespace {
+
+constexpr size_t MAX_KERNEL_DIGITS = 16;
+
+/*
+    Converts the 'length' (1 to 8) digits at p, reading 8 bytes from p. Bytes past the
+    digits are shifted out before they can affect the result.
+*/
+inline uint64_t parse_digits(const char* p, size_t length)
+{
+    uint64_t x;
+    __builtin_memcpy(&x, p, sizeof(x));
+    x -= 0x3030303030303030ull;
+    x <<= (8 - length) * 8;
+    x = ((x & 0x0F0F0F0F0F0F0F0Full) * 2561) >> 8;
+    x = ((x & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+    return ((x & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32;
+}
+
+template <typename Block>
+inline size_t tokenize_blocks(const char*& cursor, const char* end, int64_t* out, size_t capacity)
+{
+    constexpr size_t WIDTH = Block::WIDTH;
+    constexpr uint64_t ALL = (WIDTH == 64) ? ~0ull : (1ull << WIDTH) - 1;
+
+    // A block always starts at a token boundary. Every integer found in it is converted
+    // from a single 8-byte load (two for more than 8 digits), which may reach up to 8
+    // bytes past the block, hence the margin.
+    const char* base = cursor;
+    size_t count = 0;
+
+    while ((size_t)(end - base) >= WIDTH + 8) {
+        uint64_t digits, spaces;
+        Block::classify(base, digits, spaces);
+
+        // Only the bytes before the first one that is neither a digit nor whitespace are ours.
+        uint64_t other = ~(digits | spaces) & ALL;
+        size_t stop = other ? __builtin_ctzll(other) : WIDTH;
+        uint64_t non_digits = ~digits & ALL;
+        uint64_t starts = digits & ~(digits << 1);
+
+        const char* next_base = base + WIDTH;
+        while (starts != 0) {
+            size_t first = __builtin_ctzll(starts);
+            if (first >= stop) {
+                break;
+            }
+            uint64_t rest = non_digits >> first;
+            if (rest == 0) {
+                // The integer continues in the next block, which will start with it.
+                next_base = base + first;
+                break;
+            }
+            size_t length = __builtin_ctzll(rest);
+            if (first + length >= stop || length > MAX_KERNEL_DIGITS) {
+                // Leave integers that run into something else, or that may not fit, to the scalar path.
+                cursor = base + first;
+                return count;
+            }
+
+            const char* p = base + first;
+            uint64_t value = (length <= 8)
+                ? parse_digits(p, length)
+                : parse_digits(p, length - 8) * 100000000ull + parse_digits(p + length - 8, 8);
+            out[count++] = (int64_t)value;
+            if (count == capacity) {
+                cursor = p + length;
+                return count;
+            }
+            starts &= starts - 1;
+        }
+
+        if (next_base == base) {
+            // A single integer spans the whole block.
+            cursor = base;
+            return count;
+        }
+        if (stop < WIDTH && next_base == base + WIDTH) {
+            cursor = base + stop;
+            return count;
+        }
+        base = next_base;
+    }
+
+    cursor = base;
+    return count;
+}
+
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef INT_SCANNER_KERNELS_HPP
+#define INT_SCANNER_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+    Tokenizer kernels:
+        Bulk integer tokenizers for IntScanner, one per instruction set. Each one decodes
+        as many whitespace-separated, unsigned integers as it can from [cursor, end) into
+        out, up to capacity of them, and returns how many it decoded. cursor is advanced
+        past the integers decoded.
+
+        A kernel only handles the easy cases. It stops early, leaving cursor at the start
+        of the token it could not handle, at anything that is neither a digit nor
+        whitespace (signs, garbage), at integers of more than 16 digits, and within the
+        last block of the input. IntScanner's scalar path takes care of those.
+
+        Each kernel is compiled for its own instruction set and must only be called if
+        the CPU supports it.
+*/
+
+using TokenizeKernel = size_t (*)(const char*& cursor, const char* end, int64_t* out, size_t capacity);
+
+size_t tokenize_avx2(const char*& cursor, const char* end, int64_t* out, size_t capacity);
+
+size_t tokenize_sse42(const char*& cursor, const char* end, int64_t* out, size_t capacity);
+
+#endif
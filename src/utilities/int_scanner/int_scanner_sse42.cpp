@@ -0,0 +1,34 @@
+// Everything in this file is compiled for SSE4.2; it is only called if the CPU supports it.
+#pragma GCC target("sse4.2")
+
+#include <nmmintrin.h>
+
+#include "utilities/int_scanner/int_scanner_kernels.hpp"
+#include "utilities/int_scanner/int_scanner_blocks.hpp"
+
+namespace {
+
+struct Sse42Block {
+    static constexpr size_t WIDTH = 16;
+
+    static inline void classify(const char* bytes, uint64_t& digits, uint64_t& spaces) {
+        const int MODE = _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_BIT_MASK;
+
+        // Byte ranges to match: '0'-'9' for digits, '\t'-'\r' and ' ' for whitespace.
+        const __m128i digit_range = _mm_setr_epi8('0', '9', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i space_ranges = _mm_setr_epi8('\t', '\r', ' ', ' ', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+        // A NUL byte ends the string for these instructions, so nothing after it matches;
+        // the kernel stops there and the scalar path rejects the NUL.
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+        digits = (uint32_t)_mm_cvtsi128_si32(_mm_cmpistrm(digit_range, v, MODE));
+        spaces = (uint32_t)_mm_cvtsi128_si32(_mm_cmpistrm(space_ranges, v, MODE));
+    }
+};
+
+}
+
+size_t tokenize_sse42(const char*& cursor, const char* end, int64_t* out, size_t capacity)
+{
+    return tokenize_blocks<Sse42Block>(cursor, end, out, capacity);
+}
@@ -5,7 +5,7 @@
 #include <sstream>
 #include <iostream>
 
-#include "types/thread/thread.hpp"
+#include "types/thread_table/thread_table.hpp"
 #include "types/event/event.hpp"
 #include "types/process/process.hpp"
 #include "types/system_stats/system_stats.hpp"
@@ -40,7 +40,7 @@ inline const char* EVENT_MAP[8] = {
     "DISPATCHER_INVOKED"
 };
 
-void Logger::print_state_transition(const std::shared_ptr<Event> event, ThreadState before_state, ThreadState after_state) const {
+void Logger::print_state_transition(const ThreadTable& threads, const Event& event, ThreadState before_state, ThreadState after_state) const {
     /*
     This (along with print_verbose) prints something like this:
 
@@ -50,32 +50,36 @@ void Logger::print_state_transition(const std::shared_ptr<Event> event, ThreadSt
         Transitioned from NEW to READY
     */
 
+    if (!this->verbose) {
+        return;
+    }
+
     std::string message;
-    if (event->type == EventType::DISPATCHER_INVOKED && event->scheduling_decision != nullptr) {
-	    message = event->scheduling_decision->explanation;
+    if (event.type == EventType::DISPATCHER_INVOKED && event.scheduling_decision.reason != NO_DECISION) {
+	    message = event.scheduling_decision.explanation();
     }
     else {
 	    message = fmt::format("Transitioned from {} to {}", STATE_MAP[before_state], STATE_MAP[after_state]);
     }
 
-    print_verbose(event, event->thread, message);
+    print_verbose(threads, event, event.thread, message);
 }
 
 
-void Logger::print_verbose(const std::shared_ptr<Event> event, std::shared_ptr<Thread> thread, std::string message) const {
-    if (!this->verbose || thread == nullptr){
+void Logger::print_verbose(const ThreadTable& threads, const Event& event, ThreadHandle thread, std::string message) const {
+    if (!this->verbose || thread == NO_THREAD){
         return;
     }
 
-    std::string verbose_message = fmt::format("At time {}:\n", event->time);
-    verbose_message += fmt::format("    {}\n", EVENT_MAP[event->type]);
-    verbose_message += fmt::format("    Thread {} in process {} [{}]\n", thread->thread_id, thread->process_id, PROCESS_PRIORITY_MAP[thread->priority]);
+    std::string verbose_message = fmt::format("At time {}:\n", event.time);
+    verbose_message += fmt::format("    {}\n", EVENT_MAP[event.type]);
+    verbose_message += fmt::format("    Thread {} in process {} [{}]\n", threads.thread_id[thread], threads.process_id[thread], PROCESS_PRIORITY_MAP[threads.priority[thread]]);
     verbose_message += fmt::format("    {}\n\n", message);
 
     std::cout << verbose_message;
 }
 
-void Logger::print_per_thread_metrics(std::shared_ptr<Process> process) const {
+void Logger::print_per_thread_metrics(const ThreadTable& threads, const Process* process) const {
     /*
     This prints something like this:
 
@@ -94,16 +98,16 @@ void Logger::print_per_thread_metrics(std::shared_ptr<Process> process) const {
     message = fmt::format("Process {} [{}]:\n", process->process_id, PROCESS_PRIORITY_MAP[process->priority]);
     std::cout << message;
 
-    for (auto thread : process->threads) {
+    for (ThreadHandle thread : process->threads) {
 
         std::string thread_message;
 
-        thread_message = fmt::format("    Thread {:>2}:    ", thread->thread_id);
-        thread_message += fmt::format("ARR: {:<6} ", thread->arrival_time);
-        thread_message += fmt::format("CPU: {:<6} ", thread->service_time);
-        thread_message += fmt::format("I/O: {:<6} ", thread->io_time);
-        thread_message += fmt::format("TRT: {:<6} ", thread->turnaround_time());
-        thread_message += fmt::format("END: {:<6}\n", thread->end_time);
+        thread_message = fmt::format("    Thread {:>2}:    ", threads.thread_id[thread]);
+        thread_message += fmt::format("ARR: {:<6} ", threads.arrival_time[thread]);
+        thread_message += fmt::format("CPU: {:<6} ", threads.service_time[thread]);
+        thread_message += fmt::format("I/O: {:<6} ", threads.io_time[thread]);
+        thread_message += fmt::format("TRT: {:<6} ", threads.turnaround_time(thread));
+        thread_message += fmt::format("END: {:<6}\n", threads.end_time[thread]);
         std::cout << thread_message;
     }
     std::cout << "\n";
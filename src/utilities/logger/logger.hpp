@@ -5,7 +5,7 @@
 #include <string>
 #include "types/event/event.hpp"
 #include "types/process/process.hpp"
-#include "types/thread/thread.hpp"
+#include "types/thread_table/thread_table.hpp"
 #include "types/system_stats/system_stats.hpp"
 
 /*
@@ -62,26 +62,26 @@ public:
     Logger(bool verbose, bool per_thread, bool metrics) : verbose(verbose), per_thread(per_thread), metrics(metrics) {}
 
     /*
-        print_state_transition(event, before_state, after_state):
+        print_state_transition(threads, event, before_state, after_state):
             If 'verbose' is set to true, outputs a human-readable message indicating
             that the thread associated with the given event has transitioned from
-            before_state to after_state.
+            before_state to after_state. The thread is looked up in 'threads'.
     */
-    void print_state_transition(const std::shared_ptr<Event> event, ThreadState before_state, ThreadState after_state) const;
+    void print_state_transition(const ThreadTable& threads, const Event& event, ThreadState before_state, ThreadState after_state) const;
 
     /*
-        print_verbose(event, thread, message):
+        print_verbose(threads, event, thread, message):
             Outputs the given message if verbose is true. Helper function for
             print_state_transition.
     */
-    void print_verbose(const std::shared_ptr<Event> event, std::shared_ptr<Thread> thread, std::string message) const;
+    void print_verbose(const ThreadTable& threads, const Event& event, ThreadHandle thread, std::string message) const;
 
     /*
-        print_per_thread_metrics(process):
+        print_per_thread_metrics(threads, process):
             If per_thread is set to true, outputs detailed information
             about a process and its threads.
     */
-    void print_per_thread_metrics(std::shared_ptr<Process> process) const;
+    void print_per_thread_metrics(const ThreadTable& threads, const Process* process) const;
 
     /*
         print_simulation_metrics(stats):
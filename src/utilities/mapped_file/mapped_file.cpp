@@ -0,0 +1,64 @@
+#include "utilities/mapped_file/mapped_file.hpp"
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool MappedFile::open(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+
+    length = (size_t)info.st_size;
+    if (length == 0) {
+        ::close(fd);
+        return true;
+    }
+
+    void* address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file.
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        length = 0;
+        return false;
+    }
+
+    // The parser reads the file front to back exactly once.
+    madvise(address, length, MADV_SEQUENTIAL);
+
+    bytes = static_cast<const char*>(address);
+    mapped = true;
+    return true;
+}
+
+void MappedFile::drop_before(size_t offset) {
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t end = std::min(offset, length) / page_size * page_size;
+    if (!mapped || end <= dropped) {
+        return;
+    }
+    madvise(const_cast<char*>(bytes) + dropped, end - dropped, MADV_DONTNEED);
+    dropped = end;
+}
+
+void MappedFile::close() {
+    if (mapped) {
+        munmap(const_cast<char*>(bytes), length);
+    }
+    bytes = nullptr;
+    length = 0;
+    dropped = 0;
+    mapped = false;
+}
@@ -0,0 +1,64 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+/*
+    MappedFile:
+        A read-only memory mapping of a whole file. The file's bytes can be read
+        straight from data() without copying them into a stream buffer first. The
+        mapping is removed when the object is destroyed.
+*/
+
+class MappedFile {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    MappedFile() {}
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() { close(); }
+
+    /*
+        open(path):
+            Maps the file at path, replacing any previous mapping. Returns false if
+            the file cannot be opened or mapped. An empty file maps to size() == 0.
+    */
+    bool open(const std::string& path);
+
+    /*
+        close():
+            Removes the mapping, if there is one.
+    */
+    void close();
+
+    /*
+        drop_before(offset):
+            Tells the kernel that the bytes before offset will not be read again, so
+            their pages can leave memory right away. Reading them again still works,
+            it just goes back to the file.
+    */
+    void drop_before(size_t offset);
+
+    const char* data() const { return bytes; }
+
+    size_t size() const { return length; }
+
+    const char* begin() const { return bytes; }
+
+    const char* end() const { return bytes + length; }
+
+private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+    size_t dropped = 0;
+    bool mapped = false;
+};
+
+#endif
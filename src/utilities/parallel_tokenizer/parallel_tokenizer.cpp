@@ -0,0 +1,106 @@
+#include "utilities/parallel_tokenizer/parallel_tokenizer.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "utilities/int_scanner/int_scanner.hpp"
+
+ParallelTokenizer::ParallelTokenizer(const char* begin, const char* end, unsigned workers, size_t chunk_size) {
+    // Two chunks per worker have to fit in the window, so more workers get smaller chunks.
+    size_t per_worker = std::max<size_t>(1, workers);
+    chunk_size = std::max(std::min(chunk_size, MAX_WINDOW_BYTES / (2 * per_worker)), std::min(chunk_size, MIN_CHUNK_SIZE));
+    window = std::max<size_t>(1, std::min(2 * per_worker, MAX_WINDOW_BYTES / chunk_size));
+
+    const char* chunk_begin = begin;
+    while (chunk_begin != end) {
+        const char* chunk_end = ((size_t)(end - chunk_begin) > chunk_size) ? chunk_begin + chunk_size : end;
+        while (chunk_end != end && !IntScanner::is_space(*chunk_end)) {
+            chunk_end++;
+        }
+        Chunk chunk;
+        chunk.begin = chunk_begin;
+        chunk.end = chunk_end;
+        chunks.push_back(std::move(chunk));
+        chunk_begin = chunk_end;
+    }
+
+    // Workers past the window would only wait for a free slot, which only happens once the
+    // chunks are as small as they get.
+    workers = (unsigned)std::min((size_t)workers, window);
+    for (unsigned i = 0; i < workers; ++i) {
+        this->workers.emplace_back(&ParallelTokenizer::work, this);
+    }
+}
+
+ParallelTokenizer::~ParallelTokenizer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    slot_free.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ParallelTokenizer::work() {
+    while (true) {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            slot_free.wait(lock, [this] {
+                return stopping || next_to_claim == chunks.size() || next_to_claim < next_to_hand_out + window;
+            });
+            if (stopping || next_to_claim == chunks.size()) {
+                return;
+            }
+            index = next_to_claim++;
+        }
+
+        Chunk& chunk = chunks[index];
+        std::vector<int64_t> tokens;
+        const char* stopped = chunk.end;
+        std::exception_ptr failure;
+        try {
+            // About one integer per three bytes, in the usual simulation file.
+            tokens.reserve((chunk.end - chunk.begin) / 3);
+            stopped = IntScanner::tokenize(chunk.begin, chunk.end, tokens);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            chunk.tokens = std::move(tokens);
+            chunk.stopped = stopped;
+            chunk.ready = true;
+            if (failure && !error) {
+                error = failure;
+            }
+        }
+        chunk_ready.notify_all();
+    }
+}
+
+bool ParallelTokenizer::next(std::vector<int64_t>& tokens, const char*& stopped, const char*& chunk_end) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (next_to_hand_out == chunks.size()) {
+        return false;
+    }
+
+    Chunk& chunk = chunks[next_to_hand_out];
+    chunk_ready.wait(lock, [&chunk, this] { return chunk.ready || error; });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    tokens = std::move(chunk.tokens);
+    chunk.tokens = std::vector<int64_t>();
+    stopped = chunk.stopped;
+    chunk_end = chunk.end;
+    next_to_hand_out++;
+
+    lock.unlock();
+    slot_free.notify_all();
+    return true;
+}
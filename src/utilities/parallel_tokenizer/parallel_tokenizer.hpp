@@ -0,0 +1,115 @@
+#ifndef PARALLEL_TOKENIZER_HPP
+#define PARALLEL_TOKENIZER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+    ParallelTokenizer:
+        Decodes the integers of a large simulation file on several threads at once.
+
+        The file is cut into chunks at whitespace, so that no integer straddles two
+        chunks, and worker threads tokenize the chunks (see IntScanner::tokenize)
+        while the reader consumes them in file order through an IntScanner. Up to two
+        chunks per worker are decoded ahead of the reader. With many workers the chunks
+        get smaller, so that those chunks never add up to more than MAX_WINDOW_BYTES of
+        the file: the memory used by decoded integers stays the same however many
+        workers there are, and every worker still has chunks to decode, down to
+        MIN_CHUNK_SIZE. That only limits the number of workers past 512.
+
+        Knowing what the integers mean is left to the reader, so the chunks need
+        no knowledge of where processes or threads begin.
+*/
+
+class ParallelTokenizer {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        ParallelTokenizer(begin, end, workers, chunk_size):
+            Starts 'workers' threads tokenizing [begin, end), which must outlive the
+            tokenizer, in chunks of about chunk_size bytes, or smaller ones if two
+            chunks per worker would not fit in MAX_WINDOW_BYTES. Past 512 workers,
+            only as many start as there are MIN_CHUNK_SIZE chunks allowed ahead.
+    */
+    ParallelTokenizer(const char* begin, const char* end, unsigned workers, size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+    ParallelTokenizer(const ParallelTokenizer&) = delete;
+    ParallelTokenizer& operator=(const ParallelTokenizer&) = delete;
+
+    /*
+        ~ParallelTokenizer():
+            Stops the workers, even if not every chunk was consumed.
+    */
+    ~ParallelTokenizer();
+
+    /*
+        next(tokens, stopped, chunk_end):
+            Waits for the next chunk and moves its integers into tokens. If the chunk
+            holds a token that is not an integer, [stopped, chunk_end) is the rest of
+            the chunk from that token on; otherwise stopped == chunk_end. Returns false
+            once every chunk has been handed out. Rethrows anything a worker threw.
+    */
+    bool next(std::vector<int64_t>& tokens, const char*& stopped, const char*& chunk_end);
+
+    /*
+        DEFAULT_CHUNK_SIZE:
+            Large enough that handing chunks around costs nothing next to decoding them.
+    */
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 4 << 20;
+
+    /*
+        MAX_WINDOW_BYTES:
+            How many bytes of the file may be decoded ahead of the reader at once, however
+            many workers there are. Decoded integers take about 8/3 times the text they
+            came from, so this holds them to a little under 100 MB.
+    */
+    static constexpr size_t MAX_WINDOW_BYTES = 32 << 20;
+
+    /*
+        MIN_CHUNK_SIZE:
+            The smallest chunk the workers are handed, which still takes far longer to
+            decode than to hand around.
+    */
+    static constexpr size_t MIN_CHUNK_SIZE = 64 << 10;
+
+private:
+
+    struct Chunk {
+        const char* begin;
+        const char* end;
+        const char* stopped = nullptr;
+        std::vector<int64_t> tokens;
+        bool ready = false;
+    };
+
+    std::vector<Chunk> chunks;
+
+    /*
+        The next chunk a worker should claim, the next chunk to hand to the reader, and
+        how far the workers may run ahead of the reader.
+    */
+    size_t next_to_claim = 0;
+    size_t next_to_hand_out = 0;
+    size_t window;
+
+    std::mutex mutex;
+    std::condition_variable chunk_ready;
+    std::condition_variable slot_free;
+    bool stopping = false;
+    std::exception_ptr error;
+
+    std::vector<std::thread> workers;
+
+    void work();
+};
+
+#endif
@@ -0,0 +1,115 @@
+#include "utilities/parse_cache/parse_cache.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "utilities/binary_workload/binary_workload.hpp"
+#include "utilities/fmt/format.h"
+
+/*
+    A 64-bit hash over 8-byte words, fast enough to run over the whole input on every
+    lookup. It only needs to tell different versions of a file apart, not resist attacks.
+*/
+static uint64_t hash_bytes(const char* data, size_t size) {
+    const uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+    uint64_t hash = size * MULTIPLIER;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * MULTIPLIER;
+        hash ^= hash >> 29;
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, data + i, size - i);
+    hash = (hash ^ tail) * MULTIPLIER;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+ParseCache::ParseCache(const std::string& directory) : directory(directory) {
+    if (mkdir(directory.c_str(), 0777) != 0 && errno != EEXIST) {
+        std::cerr << "Unable to create parse cache directory " << directory << ": " << std::strerror(errno) << std::endl;
+    }
+}
+
+std::string ParseCache::entry_for(const std::string& input_path, const MappedFile& input, ParseCacheHeader& header) const {
+    char resolved[PATH_MAX];
+    struct stat info;
+    if (realpath(input_path.c_str(), resolved) == nullptr || stat(resolved, &info) != 0) {
+        return "";
+    }
+
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, PARSE_CACHE_MAGIC, sizeof(header.magic));
+    header.version = PARSE_CACHE_VERSION;
+    header.header_size = sizeof(ParseCacheHeader);
+    header.source_size = (uint64_t)info.st_size;
+    header.source_mtime_sec = (int64_t)info.st_mtim.tv_sec;
+    header.source_mtime_nsec = (int64_t)info.st_mtim.tv_nsec;
+    header.source_hash = hash_bytes(input.data(), input.size());
+
+    return fmt::format("{}/{:016x}.cache", directory, hash_bytes(resolved, std::strlen(resolved)));
+}
+
+const char* ParseCache::load(const std::string& input_path, const MappedFile& input, MappedFile& cached, size_t& workload_size) {
+    ParseCacheHeader expected;
+    std::string entry = entry_for(input_path, input, expected);
+    if (entry.empty() || !cached.open(entry)) {
+        return nullptr;
+    }
+
+    if (cached.size() < sizeof(ParseCacheHeader) ||
+        std::memcmp(cached.data(), &expected, sizeof(ParseCacheHeader)) != 0) {
+        cached.close();
+        return nullptr;
+    }
+
+    // Make sure the entry itself is intact before handing it out.
+    const char* workload = cached.data() + sizeof(ParseCacheHeader);
+    workload_size = cached.size() - sizeof(ParseCacheHeader);
+    try {
+        BinaryWorkload check(workload, workload_size);
+    } catch (const std::runtime_error&) {
+        cached.close();
+        return nullptr;
+    }
+    return workload;
+}
+
+void ParseCache::store(const std::string& input_path, const MappedFile& input, int64_t thread_switch_overhead,
+                       int64_t process_switch_overhead, const ThreadTable& threads, const std::vector<const Process*>& processes) {
+    ParseCacheHeader header;
+    std::string entry = entry_for(input_path, input, header);
+    if (entry.empty()) {
+        return;
+    }
+
+    std::string temporary = fmt::format("{}.{}.tmp", entry, getpid());
+    {
+        std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+        if (output) {
+            output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            BinaryWorkload::write(output, thread_switch_overhead, process_switch_overhead, threads, processes);
+            output.flush();
+        }
+        if (!output) {
+            std::cerr << "Unable to write parse cache entry " << temporary << std::endl;
+            std::remove(temporary.c_str());
+            return;
+        }
+    }
+    if (std::rename(temporary.c_str(), entry.c_str()) != 0) {
+        std::cerr << "Unable to write parse cache entry " << entry << ": " << std::strerror(errno) << std::endl;
+        std::remove(temporary.c_str());
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef PARSE_CACHE_HPP
+#define PARSE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "types/process/process.hpp"
+#include "types/thread_table/thread_table.hpp"
+#include "utilities/mapped_file/mapped_file.hpp"
+
+/*
+    ParseCache:
+        A directory of already parsed simulation files, so that repeated runs on the same
+        text input can map a binary workload instead of parsing it again.
+
+        Each input gets one cache file, named after a hash of its absolute path. The cache
+        file is a ParseCacheHeader followed by a binary workload (see
+        "utilities/binary_workload/binary_workload.hpp"). The header records the input's
+        size, modification time and a hash of its contents; an entry is only used if all
+        three still match, and is rebuilt otherwise. Entries are written to a temporary
+        file and renamed into place, so concurrent runs never see a partial one.
+*/
+
+constexpr char PARSE_CACHE_MAGIC[8] = { 'C', 'P', 'U', 'S', 'I', 'M', 'P', 'C' };
+
+constexpr uint32_t PARSE_CACHE_VERSION = 1;
+
+struct ParseCacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t source_size;
+    int64_t source_mtime_sec;
+    int64_t source_mtime_nsec;
+    uint64_t source_hash;
+    uint64_t reserved[2];
+};
+
+static_assert(sizeof(ParseCacheHeader) == 64, "unexpected ParseCacheHeader layout");
+
+class ParseCache {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        ParseCache(directory):
+            Uses 'directory' for the cache, creating it if it does not exist yet.
+    */
+    explicit ParseCache(const std::string& directory);
+
+    /*
+        load(input_path, input, cached):
+            Looks for an up to date entry for the input file, whose contents are 'input'.
+            If there is one, maps it into 'cached' and returns a pointer to its binary
+            workload and, through workload_size, that workload's size. Returns nullptr
+            if there is no usable entry.
+    */
+    const char* load(const std::string& input_path, const MappedFile& input, MappedFile& cached, size_t& workload_size);
+
+    /*
+        store(input_path, input, thread_switch_overhead, process_switch_overhead, threads, processes):
+            Writes the parsed contents of the input file as its cache entry. Failing to
+            write the cache is reported on stderr, but is not an error.
+    */
+    void store(const std::string& input_path, const MappedFile& input, int64_t thread_switch_overhead,
+               int64_t process_switch_overhead, const ThreadTable& threads, const std::vector<const Process*>& processes);
+
+private:
+    std::string directory;
+
+    /*
+        Returns the cache file for the input, and fills in the header it should have.
+        Returns "" if the input cannot be identified.
+    */
+    std::string entry_for(const std::string& input_path, const MappedFile& input, ParseCacheHeader& header) const;
+};
+
+#endif
@@ -0,0 +1,103 @@
+#include "utilities/stream_reader/stream_reader.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include "utilities/int_scanner/int_scanner.hpp"
+
+StreamReader::StreamReader(int fd, bool owns_fd) : fd(fd), owns_fd(owns_fd), buffer(BUFFER_SIZE) {}
+
+StreamReader::~StreamReader() {
+    if (owns_fd) {
+        ::close(fd);
+    }
+}
+
+size_t StreamReader::read_some(char* out, size_t capacity) {
+    while (true) {
+        ssize_t count = ::read(fd, out, capacity);
+        if (count >= 0) {
+            return (size_t)count;
+        }
+        if (errno != EINTR) {
+            throw std::runtime_error(std::string("Unable to read simulation file: ") + std::strerror(errno));
+        }
+    }
+}
+
+bool StreamReader::fill() {
+    if (at_end) {
+        return false;
+    }
+    if (consumed > 0) {
+        std::memmove(buffer.data(), buffer.data() + consumed, filled - consumed);
+        filled -= consumed;
+        consumed = 0;
+    }
+    if (filled == buffer.size()) {
+        buffer.resize(buffer.size() * 2);
+    }
+
+    size_t count = read_some(buffer.data() + filled, buffer.size() - filled);
+    if (count == 0) {
+        at_end = true;
+        return false;
+    }
+    filled += count;
+    return true;
+}
+
+bool StreamReader::next(const char*& begin, const char*& end) {
+    while (true) {
+        // Hand out everything up to the last whitespace; what follows may be the
+        // start of a token that continues in input not read yet.
+        size_t cut = filled;
+        while (cut > consumed && !IntScanner::is_space(buffer[cut - 1])) {
+            cut--;
+        }
+        if (cut > consumed || (at_end && filled > consumed)) {
+            if (cut == consumed) {
+                cut = filled;
+            }
+            begin = buffer.data() + consumed;
+            end = buffer.data() + cut;
+            consumed = cut;
+            return true;
+        }
+        if (!fill() && filled == consumed) {
+            return false;
+        }
+    }
+}
+
+size_t StreamReader::peek(const char*& data, size_t count) {
+    while (filled - consumed < count && fill()) {
+    }
+    data = buffer.data() + consumed;
+    return std::min(count, filled - consumed);
+}
+
+void StreamReader::read_all(std::vector<char>& out) {
+    do {
+        out.insert(out.end(), buffer.begin() + consumed, buffer.begin() + filled);
+        consumed = filled;
+    } while (fill());
+}
+
+size_t StreamReader::read_bytes(char* out, size_t capacity) {
+    if (filled > consumed) {
+        size_t count = std::min(capacity, filled - consumed);
+        std::memcpy(out, buffer.data() + consumed, count);
+        consumed += count;
+        return count;
+    }
+    if (at_end) {
+        return 0;
+    }
+    return read_some(out, capacity);
+}
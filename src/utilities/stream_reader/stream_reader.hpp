@@ -0,0 +1,101 @@
+#ifndef STREAM_READER_HPP
+#define STREAM_READER_HPP
+
+#include <cstddef>
+#include <vector>
+
+/*
+    StreamReader:
+        Reads a simulation file that cannot be memory-mapped, e.g. stdin or a pipe,
+        through a fixed-size buffer, so that the simulator can parse a workload while
+        another program is still generating it.
+
+        The input is handed out in windows that end at whitespace, so that no integer
+        is split between two windows and an IntScanner can tokenize each window on
+        its own. Only the part of a token cut off at the end of the buffer is carried
+        over into the next window.
+*/
+
+class StreamReader {
+public:
+
+    //==================================================
+    //  Member functions
+    //==================================================
+
+    /*
+        StreamReader(fd, owns_fd):
+            Reads from the open file descriptor fd, closing it when done if owns_fd.
+    */
+    StreamReader(int fd, bool owns_fd);
+
+    StreamReader(const StreamReader&) = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+
+    virtual ~StreamReader();
+
+    /*
+        next(begin, end):
+            Sets [begin, end) to the next window of the input, which stays valid until
+            the next call. Blocks until some input is available. Returns false at the
+            end of the input.
+    */
+    bool next(const char*& begin, const char*& end);
+
+    /*
+        peek(data, count):
+            Makes the next 'count' bytes available at data without consuming them, and
+            returns how many there are, which is fewer only at the end of the input.
+    */
+    size_t peek(const char*& data, size_t count);
+
+    /*
+        read_all(out):
+            Appends everything that has not been consumed yet to out.
+    */
+    void read_all(std::vector<char>& out);
+
+    /*
+        read_bytes(out, capacity):
+            Moves up to capacity bytes that have not been consumed yet into out, not
+            splitting them into windows, and returns how many, or 0 at the end of the
+            input. This is how a GzipReader takes the compressed input.
+    */
+    size_t read_bytes(char* out, size_t capacity);
+
+    /*
+        BUFFER_SIZE:
+            How much input is read at a time.
+    */
+    static constexpr size_t BUFFER_SIZE = 1 << 20;
+
+protected:
+
+    /*
+        read_some(out, capacity):
+            Reads up to capacity bytes of input into out and returns how many, or 0 at
+            the end of the input. Throws std::runtime_error if reading fails.
+    */
+    virtual size_t read_some(char* out, size_t capacity);
+
+private:
+    int fd;
+    bool owns_fd;
+
+    std::vector<char> buffer;
+
+    /*
+        The unconsumed input is buffer[consumed, filled).
+    */
+    size_t consumed = 0;
+    size_t filled = 0;
+    bool at_end = false;
+
+    /*
+        Moves the unconsumed input to the front of the buffer, growing the buffer if it
+        is already full, and reads more after it. Returns false at the end of the input.
+    */
+    bool fill();
+};
+
+#endif
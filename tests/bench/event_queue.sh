@@ -0,0 +1,58 @@
+#!/usr/bin/env bash
+# Times the HEAP and RADIX event queues on an arrival-heavy trace: a thread arrives
+# every couple of ticks, so the simulation peeks at the next event before every arrival
+# and keeps pushing events just after the last popped one. Fails if RADIX is slower.
+#
+# usage: tests/bench/event_queue.sh [processes] [runs]
+set -euo pipefail
+
+SIM=${SIM:-./cpu-sim}
+PROCESSES=${1:-400}
+RUNS=${2:-3}
+# RADIX may be this many percent slower before the benchmark fails, to absorb timing noise.
+TOLERANCE=${TOLERANCE:-5}
+
+trace=$(mktemp)
+trap 'rm -f "$trace"' EXIT
+
+awk -v processes="$PROCESSES" 'BEGIN {
+    srand(1)
+    printf "%d 2 5\n\n", processes
+    t = 0
+    for (p = 0; p < processes; p++) {
+        printf "%d %d 50\n", p, int(rand() * 4)
+        for (th = 0; th < 50; th++) {
+            t += int(rand() * 4)
+            printf "%d 5\n", t
+            for (b = 0; b < 4; b++) {
+                printf "%d %d\n", 1 + int(rand() * 500), 1 + int(rand() * 500)
+            }
+            printf "%d\n\n", 1 + int(rand() * 500)
+        }
+    }
+}' > "$trace"
+
+best_ms() {
+    local best=""
+    for ((i = 0; i < RUNS; i++)); do
+        local start end
+        start=$(date +%s%N)
+        "$SIM" -a RR -s 7 -m -q "$1" "$trace" > /dev/null
+        end=$(date +%s%N)
+        local ms=$(( (end - start) / 1000000 ))
+        if [[ -z "$best" || "$ms" -lt "$best" ]]; then
+            best=$ms
+        fi
+    done
+    echo "$best"
+}
+
+heap=$(best_ms HEAP)
+radix=$(best_ms RADIX)
+echo "HEAP:  ${heap} ms"
+echo "RADIX: ${radix} ms"
+
+if (( radix * 100 > heap * (100 + TOLERANCE) )); then
+    echo "RADIX is slower than HEAP"
+    exit 1
+fi
@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+# Times parsing a large text trace on one thread (-j 1) against JOBS threads (one per core by
+# default). The trace has many bursts per thread, so that a FCFS run spends much of its time
+# tokenizing the file. Fails if the parallel parse is slower, unless the host has fewer cores
+# than JOBS, where no speedup is possible.
+#
+# usage: tests/bench/parse_jobs.sh [processes] [runs]
+set -euo pipefail
+
+SIM=${SIM:-./cpu-sim}
+PROCESSES=${1:-4000}
+RUNS=${2:-3}
+CORES=$(nproc)
+JOBS=${JOBS:-$CORES}
+if (( JOBS < 2 )); then
+    JOBS=2
+fi
+# The parallel parse may be this many percent slower before the benchmark fails, to absorb timing noise.
+TOLERANCE=${TOLERANCE:-5}
+
+trace=$(mktemp)
+trap 'rm -f "$trace"' EXIT
+
+awk -v processes="$PROCESSES" 'BEGIN {
+    srand(1)
+    printf "%d 2 5\n\n", processes
+    t = 0
+    for (p = 0; p < processes; p++) {
+        printf "%d %d 50\n", p, int(rand() * 4)
+        for (th = 0; th < 50; th++) {
+            t += int(rand() * 400)
+            printf "%d 25\n", t
+            for (b = 0; b < 24; b++) {
+                printf "%d %d\n", 1 + int(rand() * 500), 1 + int(rand() * 500)
+            }
+            printf "%d\n\n", 1 + int(rand() * 500)
+        }
+    }
+}' > "$trace"
+
+best_ms() {
+    local best=""
+    for ((i = 0; i < RUNS; i++)); do
+        local start end
+        start=$(date +%s%N)
+        "$SIM" -a FCFS -m -j "$1" "$trace" > /dev/null
+        end=$(date +%s%N)
+        local ms=$(( (end - start) / 1000000 ))
+        if [[ -z "$best" || "$ms" -lt "$best" ]]; then
+            best=$ms
+        fi
+    done
+    echo "$best"
+}
+
+echo "Trace: $(( $(wc -c < "$trace") >> 20 )) MB, $CORES cores"
+serial=$(best_ms 1)
+parallel=$(best_ms "$JOBS")
+printf '%-8s %6d ms\n' "-j 1:" "$serial" "-j ${JOBS}:" "$parallel"
+
+if (( CORES < JOBS )); then
+    echo "Fewer cores than parse jobs; not checking for a speedup"
+elif (( parallel * 100 > serial * (100 + TOLERANCE) )); then
+    echo "Parsing on ${JOBS} threads is slower than on one"
+    exit 1
+fi
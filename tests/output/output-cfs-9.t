@@ -0,0 +1,11 @@
+SIMULATION COMPLETED!
+
+Process 0 [NORMAL]:
+    Thread  0:    ARR: 0      CPU: 2      I/O: 0      TRT: 2      END: 2     
+    Thread  1:    ARR: 1      CPU: 20     I/O: 0      TRT: 28     END: 29    
+
+Process 1 [BATCH]:
+    Thread  0:    ARR: 1      CPU: 8      I/O: 0      TRT: 33     END: 34    
+
+Process 2 [SYSTEM]:
+    Thread  0:    ARR: 1      CPU: 4      I/O: 0      TRT: 11     END: 12    
@@ -0,0 +1,111 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads; it has the least virtual runtime. Will run for at most 24 ticks.
+
+At time 0:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1:
+    THREAD_ARRIVED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 1:
+    THREAD_ARRIVED
+    Thread 0 in process 1 [BATCH]
+    Transitioned from NEW to READY
+
+At time 1:
+    THREAD_ARRIVED
+    Thread 0 in process 2 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 2:
+    THREAD_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 2:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 3 threads; it has the least virtual runtime. Will run for at most 3 ticks.
+
+At time 2:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 5:
+    THREAD_PREEMPTED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 5:
+    DISPATCHER_INVOKED
+    Thread 0 in process 1 [BATCH]
+    Selected from 3 threads; it has the least virtual runtime. Will run for at most 3 ticks.
+
+At time 5:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 1 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 8:
+    THREAD_PREEMPTED
+    Thread 0 in process 1 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 8:
+    DISPATCHER_INVOKED
+    Thread 0 in process 2 [SYSTEM]
+    Selected from 3 threads; it has the least virtual runtime. Will run for at most 21 ticks.
+
+At time 8:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 2 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 12:
+    THREAD_COMPLETED
+    Thread 0 in process 2 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 12:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 2 threads; it has the least virtual runtime. Will run for at most 18 ticks.
+
+At time 12:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 29:
+    THREAD_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 29:
+    DISPATCHER_INVOKED
+    Thread 0 in process 1 [BATCH]
+    Selected from 1 threads; it has the least virtual runtime. Will run for at most 24 ticks.
+
+At time 29:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 1 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 34:
+    THREAD_COMPLETED
+    Thread 0 in process 1 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
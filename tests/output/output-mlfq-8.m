@@ -0,0 +1,30 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                  5
+    Avg. response time:        3.00
+    Avg. turnaround time:     18.20
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:            124
+Total service time:             56
+Total I/O time:                  4
+Total dispatch time:             0
+Total idle time:                 2
+
+CPU utilization:            98.39%
+CPU efficiency:             45.16%
@@ -0,0 +1,8 @@
+SIMULATION COMPLETED!
+
+Process 0 [NORMAL]:
+    Thread  0:    ARR: 0      CPU: 12     I/O: 0      TRT: 17     END: 17    
+    Thread  1:    ARR: 1      CPU: 10     I/O: 4      TRT: 23     END: 24    
+    Thread  2:    ARR: 90     CPU: 30     I/O: 0      TRT: 34     END: 124   
+    Thread  3:    ARR: 100    CPU: 2      I/O: 0      TRT: 13     END: 113   
+    Thread  4:    ARR: 114    CPU: 2      I/O: 0      TRT: 4      END: 118   
@@ -0,0 +1,261 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 3 ticks.
+
+At time 0:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 1:
+    THREAD_ARRIVED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 3:
+    THREAD_PREEMPTED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 3:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 2 threads; it is in the highest non-empty level. Will run for at most 3 ticks.
+
+At time 3:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6:
+    THREAD_PREEMPTED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 6:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 2 threads; it is in the highest non-empty level. Will run for at most 6 ticks.
+
+At time 6:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 12:
+    THREAD_PREEMPTED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 12:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 2 threads; it is in the highest non-empty level. Will run for at most 6 ticks.
+
+At time 12:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 14:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 12 ticks.
+
+At time 14:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 16:
+    IO_BURST_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 17:
+    THREAD_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 17:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 3 ticks.
+
+At time 17:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20:
+    THREAD_PREEMPTED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 20:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 6 ticks.
+
+At time 20:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 21:
+    CPU_BURST_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to BLOCKED
+
+At time 23:
+    IO_BURST_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from BLOCKED to READY
+
+At time 23:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 3 ticks.
+
+At time 23:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 24:
+    THREAD_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 90:
+    THREAD_ARRIVED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 90:
+    DISPATCHER_INVOKED
+    Thread 2 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 3 ticks.
+
+At time 90:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 93:
+    THREAD_PREEMPTED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 93:
+    DISPATCHER_INVOKED
+    Thread 2 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 6 ticks.
+
+At time 93:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 99:
+    THREAD_PREEMPTED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 99:
+    DISPATCHER_INVOKED
+    Thread 2 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 12 ticks.
+
+At time 99:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 100:
+    THREAD_ARRIVED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 111:
+    THREAD_PREEMPTED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 111:
+    DISPATCHER_INVOKED
+    Thread 3 in process 0 [NORMAL]
+    Selected from 2 threads; it is in the highest non-empty level. Will run for at most 3 ticks.
+
+At time 111:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 113:
+    THREAD_COMPLETED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 113:
+    DISPATCHER_INVOKED
+    Thread 2 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 3 ticks.
+
+At time 113:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 114:
+    THREAD_ARRIVED
+    Thread 4 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 116:
+    THREAD_PREEMPTED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 116:
+    DISPATCHER_INVOKED
+    Thread 4 in process 0 [NORMAL]
+    Selected from 2 threads; it is in the highest non-empty level. Will run for at most 3 ticks.
+
+At time 116:
+    THREAD_DISPATCH_COMPLETED
+    Thread 4 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 118:
+    THREAD_COMPLETED
+    Thread 4 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 118:
+    DISPATCHER_INVOKED
+    Thread 2 in process 0 [NORMAL]
+    Selected from 1 threads; it is in the highest non-empty level. Will run for at most 6 ticks.
+
+At time 118:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 124:
+    THREAD_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
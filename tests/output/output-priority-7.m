@@ -0,0 +1,30 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  1
+    Avg. response time:        4.00
+    Avg. turnaround time:      7.00
+
+INTERACTIVE THREADS:
+    Total Count:                  2
+    Avg. response time:        6.50
+    Avg. turnaround time:      8.00
+
+NORMAL THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+BATCH THREADS:
+    Total Count:                  2
+    Avg. response time:        5.50
+    Avg. turnaround time:      9.50
+
+Total elapsed time:             14
+Total service time:             14
+Total I/O time:                  0
+Total dispatch time:             0
+Total idle time:                 0
+
+CPU utilization:           100.00%
+CPU efficiency:            100.00%
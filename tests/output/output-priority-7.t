@@ -0,0 +1,12 @@
+SIMULATION COMPLETED!
+
+Process 0 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 6      I/O: 0      TRT: 6      END: 6     
+    Thread  1:    ARR: 1      CPU: 2      I/O: 0      TRT: 13     END: 14    
+
+Process 1 [SYSTEM]:
+    Thread  0:    ARR: 2      CPU: 3      I/O: 0      TRT: 7      END: 9     
+
+Process 2 [INTERACTIVE]:
+    Thread  0:    ARR: 3      CPU: 2      I/O: 0      TRT: 8      END: 11    
+    Thread  1:    ARR: 4      CPU: 1      I/O: 0      TRT: 8      END: 12    
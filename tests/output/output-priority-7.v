@@ -0,0 +1,101 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 0 [BATCH]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [BATCH]
+    Selected from 1 threads; it has the highest priority. Will run to completion of burst.
+
+At time 0:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1:
+    THREAD_ARRIVED
+    Thread 1 in process 0 [BATCH]
+    Transitioned from NEW to READY
+
+At time 2:
+    THREAD_ARRIVED
+    Thread 0 in process 1 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 3:
+    THREAD_ARRIVED
+    Thread 0 in process 2 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 4:
+    THREAD_ARRIVED
+    Thread 1 in process 2 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 6:
+    THREAD_COMPLETED
+    Thread 0 in process 0 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 6:
+    DISPATCHER_INVOKED
+    Thread 0 in process 1 [SYSTEM]
+    Selected from 4 threads; it has the highest priority. Will run to completion of burst.
+
+At time 6:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 1 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 9:
+    THREAD_COMPLETED
+    Thread 0 in process 1 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 9:
+    DISPATCHER_INVOKED
+    Thread 0 in process 2 [INTERACTIVE]
+    Selected from 3 threads; it has the highest priority. Will run to completion of burst.
+
+At time 9:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 2 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 11:
+    THREAD_COMPLETED
+    Thread 0 in process 2 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 11:
+    DISPATCHER_INVOKED
+    Thread 1 in process 2 [INTERACTIVE]
+    Selected from 2 threads; it has the highest priority. Will run to completion of burst.
+
+At time 11:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 2 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 12:
+    THREAD_COMPLETED
+    Thread 1 in process 2 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 12:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [BATCH]
+    Selected from 1 threads; it has the highest priority. Will run to completion of burst.
+
+At time 12:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 0 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14:
+    THREAD_COMPLETED
+    Thread 1 in process 0 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
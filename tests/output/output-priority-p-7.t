@@ -0,0 +1,12 @@
+SIMULATION COMPLETED!
+
+Process 0 [BATCH]:
+    Thread  0:    ARR: 0      CPU: 6      I/O: 0      TRT: 14     END: 14    
+    Thread  1:    ARR: 1      CPU: 2      I/O: 0      TRT: 9      END: 10    
+
+Process 1 [SYSTEM]:
+    Thread  0:    ARR: 2      CPU: 3      I/O: 0      TRT: 3      END: 5     
+
+Process 2 [INTERACTIVE]:
+    Thread  0:    ARR: 3      CPU: 2      I/O: 0      TRT: 4      END: 7     
+    Thread  1:    ARR: 4      CPU: 1      I/O: 0      TRT: 4      END: 8     
@@ -0,0 +1,116 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 0 [BATCH]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [BATCH]
+    Selected from 1 threads; it has the highest priority. Will run to completion of burst.
+
+At time 0:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 1:
+    THREAD_ARRIVED
+    Thread 1 in process 0 [BATCH]
+    Transitioned from NEW to READY
+
+At time 2:
+    THREAD_ARRIVED
+    Thread 0 in process 1 [SYSTEM]
+    Transitioned from NEW to READY
+
+At time 2:
+    THREAD_PREEMPTED
+    Thread 0 in process 0 [BATCH]
+    Transitioned from RUNNING to READY
+
+At time 2:
+    DISPATCHER_INVOKED
+    Thread 0 in process 1 [SYSTEM]
+    Selected from 3 threads; it has the highest priority. Will run to completion of burst.
+
+At time 2:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 1 [SYSTEM]
+    Transitioned from READY to RUNNING
+
+At time 3:
+    THREAD_ARRIVED
+    Thread 0 in process 2 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 4:
+    THREAD_ARRIVED
+    Thread 1 in process 2 [INTERACTIVE]
+    Transitioned from NEW to READY
+
+At time 5:
+    THREAD_COMPLETED
+    Thread 0 in process 1 [SYSTEM]
+    Transitioned from RUNNING to EXIT
+
+At time 5:
+    DISPATCHER_INVOKED
+    Thread 0 in process 2 [INTERACTIVE]
+    Selected from 4 threads; it has the highest priority. Will run to completion of burst.
+
+At time 5:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 2 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 7:
+    THREAD_COMPLETED
+    Thread 0 in process 2 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 7:
+    DISPATCHER_INVOKED
+    Thread 1 in process 2 [INTERACTIVE]
+    Selected from 3 threads; it has the highest priority. Will run to completion of burst.
+
+At time 7:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 2 [INTERACTIVE]
+    Transitioned from READY to RUNNING
+
+At time 8:
+    THREAD_COMPLETED
+    Thread 1 in process 2 [INTERACTIVE]
+    Transitioned from RUNNING to EXIT
+
+At time 8:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [BATCH]
+    Selected from 2 threads; it has the highest priority. Will run to completion of burst.
+
+At time 8:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 1 in process 0 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 10:
+    THREAD_COMPLETED
+    Thread 1 in process 0 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [BATCH]
+    Selected from 1 threads; it has the highest priority. Will run to completion of burst.
+
+At time 10:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 0 [BATCH]
+    Transitioned from READY to RUNNING
+
+At time 14:
+    THREAD_COMPLETED
+    Thread 0 in process 0 [BATCH]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
@@ -0,0 +1,30 @@
+SIMULATION COMPLETED!
+
+SYSTEM THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+INTERACTIVE THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+NORMAL THREADS:
+    Total Count:                  4
+    Avg. response time:        5.75
+    Avg. turnaround time:     10.75
+
+BATCH THREADS:
+    Total Count:                  0
+    Avg. response time:        0.00
+    Avg. turnaround time:      0.00
+
+Total elapsed time:             20
+Total service time:             20
+Total I/O time:                  0
+Total dispatch time:             0
+Total idle time:                 0
+
+CPU utilization:           100.00%
+CPU efficiency:            100.00%
@@ -0,0 +1,81 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads; it has the shortest next CPU burst. Will run to completion of burst.
+
+At time 0:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2:
+    THREAD_ARRIVED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 3:
+    THREAD_ARRIVED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 6:
+    THREAD_ARRIVED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 8:
+    THREAD_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 8:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 3 threads; it has the shortest next CPU burst. Will run to completion of burst.
+
+At time 8:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 11:
+    THREAD_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 11:
+    DISPATCHER_INVOKED
+    Thread 3 in process 0 [NORMAL]
+    Selected from 2 threads; it has the shortest next CPU burst. Will run to completion of burst.
+
+At time 11:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 15:
+    THREAD_COMPLETED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 15:
+    DISPATCHER_INVOKED
+    Thread 2 in process 0 [NORMAL]
+    Selected from 1 threads; it has the shortest next CPU burst. Will run to completion of burst.
+
+At time 15:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20:
+    THREAD_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!
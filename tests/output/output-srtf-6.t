@@ -0,0 +1,7 @@
+SIMULATION COMPLETED!
+
+Process 0 [NORMAL]:
+    Thread  0:    ARR: 0      CPU: 8      I/O: 0      TRT: 20     END: 20    
+    Thread  1:    ARR: 2      CPU: 3      I/O: 0      TRT: 3      END: 5     
+    Thread  2:    ARR: 3      CPU: 5      I/O: 0      TRT: 7      END: 10    
+    Thread  3:    ARR: 6      CPU: 4      I/O: 0      TRT: 8      END: 14    
@@ -0,0 +1,96 @@
+At time 0:
+    THREAD_ARRIVED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 0:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads; it has the least CPU burst left. Will run until a shorter one is ready.
+
+At time 0:
+    PROCESS_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 2:
+    THREAD_ARRIVED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 2:
+    THREAD_PREEMPTED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to READY
+
+At time 2:
+    DISPATCHER_INVOKED
+    Thread 1 in process 0 [NORMAL]
+    Selected from 2 threads; it has the least CPU burst left. Will run until a shorter one is ready.
+
+At time 2:
+    THREAD_DISPATCH_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 3:
+    THREAD_ARRIVED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 5:
+    THREAD_COMPLETED
+    Thread 1 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 5:
+    DISPATCHER_INVOKED
+    Thread 2 in process 0 [NORMAL]
+    Selected from 2 threads; it has the least CPU burst left. Will run until a shorter one is ready.
+
+At time 5:
+    THREAD_DISPATCH_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 6:
+    THREAD_ARRIVED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from NEW to READY
+
+At time 10:
+    THREAD_COMPLETED
+    Thread 2 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 10:
+    DISPATCHER_INVOKED
+    Thread 3 in process 0 [NORMAL]
+    Selected from 2 threads; it has the least CPU burst left. Will run until a shorter one is ready.
+
+At time 10:
+    THREAD_DISPATCH_COMPLETED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 14:
+    THREAD_COMPLETED
+    Thread 3 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+At time 14:
+    DISPATCHER_INVOKED
+    Thread 0 in process 0 [NORMAL]
+    Selected from 1 threads; it has the least CPU burst left. Will run until a shorter one is ready.
+
+At time 14:
+    THREAD_DISPATCH_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from READY to RUNNING
+
+At time 20:
+    THREAD_COMPLETED
+    Thread 0 in process 0 [NORMAL]
+    Transitioned from RUNNING to EXIT
+
+SIMULATION COMPLETED!